@@ -153,6 +153,31 @@ ByteString StandardPaths::config_directory()
     return LexicalPath::canonicalized_path(builder.to_byte_string());
 }
 
+ByteString StandardPaths::cache_directory()
+{
+    StringBuilder builder;
+#ifdef AK_OS_WINDOWS
+    if (auto local_appdata = get_environment_if_not_empty("LOCALAPPDATA"sv); local_appdata.has_value())
+        return LexicalPath::canonicalized_path(*local_appdata);
+    builder.append(home_directory());
+    builder.append("\\AppData\\Local"sv);
+    return LexicalPath::canonicalized_path(builder.to_byte_string());
+#endif
+    if (auto cache_directory = get_environment_if_not_empty("XDG_CACHE_HOME"sv); cache_directory.has_value())
+        return LexicalPath::canonicalized_path(*cache_directory);
+
+    builder.append(home_directory());
+#if defined(AK_OS_MACOS)
+    builder.append("/Library/Caches"sv);
+#elif defined(AK_OS_HAIKU)
+    builder.append("/config/cache"sv);
+#else
+    builder.append("/.cache"sv);
+#endif
+
+    return LexicalPath::canonicalized_path(builder.to_byte_string());
+}
+
 ByteString StandardPaths::user_data_directory()
 {
 #ifdef AK_OS_WINDOWS
@@ -30,6 +30,7 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
             m_min_block_address = block_ptr;
         if (m_max_block_address < block_ptr)
             m_max_block_address = block_ptr;
+        heap.did_create_heap_block({}, *block);
         m_usable_blocks.append(*block.leak_ptr());
     }
 
@@ -44,6 +45,7 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
 void CellAllocator::block_did_become_empty(Badge<Heap>, HeapBlock& block)
 {
     block.m_list_node.remove();
+    block.heap().did_destroy_heap_block({}, block);
     // NOTE: HeapBlocks are managed by the BlockAllocator, so we don't want to `delete` the block here.
     block.~HeapBlock();
     m_block_allocator.deallocate_block(&block);
@@ -60,30 +60,62 @@ void Heap::will_allocate(size_t size)
     m_allocated_bytes_since_last_gc += size;
 }
 
-static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
+void Heap::collect_garbage_if_idle_threshold_reached(AK::Duration time_until_idle_deadline)
+{
+    if (m_collecting_garbage || m_gc_deferrals)
+        return;
+    if (m_allocated_bytes_since_last_gc < m_gc_bytes_threshold / GC_IDLE_THRESHOLD_DIVISOR)
+        return;
+
+    // Idle periods can be as short as the gap between two tasks. Collecting in each of them would collect far more often
+    // than allocating up to the threshold does on a busy page, so leave some time between collections.
+    if (m_last_collection_end_time.has_value() && MonotonicTime::now() - *m_last_collection_end_time < GC_IDLE_MINIMUM_INTERVAL)
+        return;
+
+    // Don't run past the end of the idle period, assuming this collection takes about as long as the previous one.
+    if (m_last_collection_duration > time_until_idle_deadline)
+        return;
+
+    dbgln_if(HEAP_DEBUG, "Heap: Collecting garbage while idle ({} ms until deadline, last collection took {} ms)", time_until_idle_deadline.to_milliseconds(), m_last_collection_duration.to_milliseconds());
+    m_allocated_bytes_since_last_gc = 0;
+    collect_garbage();
+}
+
+static ALWAYS_INLINE FlatPtr possible_pointer_from_data(FlatPtr data)
 {
     if constexpr (sizeof(FlatPtr*) == sizeof(NanBoxedValue)) {
         // Because NanBoxedValue stores pointers in non-canonical form we have to check if the top bytes
         // match any pointer-backed tag, in that case we have to extract the pointer to its
         // canonical form and add that as a possible pointer.
-        FlatPtr possible_pointer;
         if ((data & SHIFTED_IS_CELL_PATTERN) == SHIFTED_IS_CELL_PATTERN)
-            possible_pointer = NanBoxedValue::extract_pointer_bits(data);
-        else
-            possible_pointer = data;
-        if (possible_pointer < min_block_address || possible_pointer > max_block_address)
-            return;
-        possible_pointers.set(possible_pointer, move(origin));
+            return NanBoxedValue::extract_pointer_bits(data);
+        return data;
     } else {
         static_assert((sizeof(NanBoxedValue) % sizeof(FlatPtr*)) == 0);
-        if (data < min_block_address || data > max_block_address)
-            return;
         // In the 32-bit case we will look at the top and bottom part of NanBoxedValue separately we just
         // add both the upper and lower bytes as possible pointers.
-        possible_pointers.set(data, move(origin));
+        return data;
     }
 }
 
+static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
+{
+    auto possible_pointer = possible_pointer_from_data(data);
+    if (possible_pointer < min_block_address || possible_pointer > max_block_address)
+        return;
+    possible_pointers.set(possible_pointer, move(origin));
+}
+
+static Cell* cell_from_possible_pointer(HashTable<HeapBlock*> const& all_live_heap_blocks, FlatPtr possible_pointer)
+{
+    if (!possible_pointer)
+        return nullptr;
+    auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
+    if (!all_live_heap_blocks.contains(possible_heap_block))
+        return nullptr;
+    return possible_heap_block->cell_from_possible_pointer(possible_pointer);
+}
+
 void Heap::find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address)
 {
     min_address = explode_byte(0xff);
@@ -98,14 +130,23 @@ template<typename Callback>
 static void for_each_cell_among_possible_pointers(HashTable<HeapBlock*> const& all_live_heap_blocks, HashMap<FlatPtr, HeapRoot>& possible_pointers, Callback callback)
 {
     for (auto possible_pointer : possible_pointers.keys()) {
-        if (!possible_pointer)
-            continue;
-        auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
-        if (!all_live_heap_blocks.contains(possible_heap_block))
-            continue;
-        if (auto* cell = possible_heap_block->cell_from_possible_pointer(possible_pointer)) {
+        if (auto* cell = cell_from_possible_pointer(all_live_heap_blocks, possible_pointer))
             callback(cell, possible_pointer);
-        }
+    }
+}
+
+// Visits every cell that a pointer-sized value in the given bytes might refer to. Unlike the root gathering above, this
+// is used for every conservatively visited cell during marking, so we avoid building an intermediate HashMap here.
+template<typename Callback>
+static void for_each_cell_among_possible_values(HashTable<HeapBlock*> const& all_live_heap_blocks, ReadonlyBytes bytes, FlatPtr min_block_address, FlatPtr max_block_address, Callback callback)
+{
+    auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
+    for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i) {
+        auto possible_pointer = possible_pointer_from_data(raw_pointer_sized_values[i]);
+        if (possible_pointer < min_block_address || possible_pointer > max_block_address)
+            continue;
+        if (auto* cell = cell_from_possible_pointer(all_live_heap_blocks, possible_pointer))
+            callback(cell);
     }
 }
 
@@ -115,10 +156,6 @@ public:
         : m_heap(heap)
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
         m_work_queue.ensure_capacity(roots.size());
 
         for (auto& [root, root_origin] : roots) {
@@ -143,17 +180,11 @@ public:
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
     {
-        HashMap<FlatPtr, HeapRoot> possible_pointers;
-
-        auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
-        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
-
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
+        for_each_cell_among_possible_values(m_heap.m_live_heap_blocks, bytes, m_min_block_address, m_max_block_address, [&](Cell* cell) {
             if (m_node_being_visited)
                 m_node_being_visited->edges.set(reinterpret_cast<FlatPtr>(cell));
 
-            if (m_graph.get(reinterpret_cast<FlatPtr>(&cell)).has_value())
+            if (m_graph.get(reinterpret_cast<FlatPtr>(cell)).has_value())
                 return;
             m_work_queue.append(*cell);
         });
@@ -223,7 +254,6 @@ private:
     HashMap<FlatPtr, GraphNode> m_graph;
 
     Heap& m_heap;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
@@ -245,8 +275,7 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
         TemporaryChange change(m_collecting_garbage, true);
 
         Core::ElapsedTimer collection_measurement_timer;
-        if (print_report)
-            collection_measurement_timer.start();
+        collection_measurement_timer.start();
 
         if (collection_type == CollectionType::CollectGarbage) {
             if (m_gc_deferrals) {
@@ -259,6 +288,10 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
         }
         finalize_unmarked_cells();
         sweep_dead_cells(print_report, collection_measurement_timer);
+
+        m_last_collection_duration = collection_measurement_timer.elapsed_time();
+        m_last_collection_end_time = MonotonicTime::now();
+        dbgln_if(HEAP_DEBUG, "Heap: Collection took {} ms", m_last_collection_duration.to_milliseconds());
     }
 
     auto tasks = move(m_post_gc_tasks);
@@ -347,13 +380,7 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
         }
     }
 
-    HashTable<HeapBlock*> all_live_heap_blocks;
-    for_each_block([&](auto& block) {
-        all_live_heap_blocks.set(&block);
-        return IterationDecision::Continue;
-    });
-
-    for_each_cell_among_possible_pointers(all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
+    for_each_cell_among_possible_pointers(m_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
         if (cell->state() == Cell::State::Live) {
             dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
             roots.set(cell, *possible_pointers.get(possible_pointer));
@@ -369,10 +396,6 @@ public:
         : m_heap(heap)
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
 
         for (auto* root : roots.keys()) {
             visit(root);
@@ -386,23 +409,19 @@ public:
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
         cell.set_marked(true);
+        HeapBlock::from_cell(&cell)->did_mark_cell();
         m_work_queue.append(cell);
     }
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
     {
-        HashMap<FlatPtr, HeapRoot> possible_pointers;
-
-        auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
-        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
-
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
+        for_each_cell_among_possible_values(m_heap.m_live_heap_blocks, bytes, m_min_block_address, m_max_block_address, [&](Cell* cell) {
             if (cell->is_marked())
                 return;
             if (cell->state() != Cell::State::Live)
                 return;
             cell->set_marked(true);
+            HeapBlock::from_cell(cell)->did_mark_cell();
             m_work_queue.append(*cell);
         });
     }
@@ -417,7 +436,6 @@ public:
 private:
     Heap& m_heap;
     Vector<Ref<Cell>> m_work_queue;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
@@ -430,10 +448,16 @@ void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
 
     visitor.mark_all_live_cells();
 
-    for (auto& inverse_root : m_uprooted_cells)
+    for (auto& inverse_root : m_uprooted_cells) {
+        if (!inverse_root->is_marked())
+            continue;
         inverse_root->set_marked(false);
+        HeapBlock::from_cell(inverse_root.ptr())->did_unmark_cell();
+    }
 
     for_each_block([&](auto& block) {
+        if (!block.has_unmarked_live_cells())
+            return IterationDecision::Continue;
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked() && cell_must_survive_garbage_collection(*cell))
                 cell->visit_edges(visitor);
@@ -454,6 +478,8 @@ bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
 void Heap::finalize_unmarked_cells()
 {
     for_each_block([&](auto& block) {
+        if (!block.has_unmarked_live_cells())
+            return IterationDecision::Continue;
         block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
             if (!cell->is_marked())
                 cell->finalize();
@@ -474,7 +500,18 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t live_cell_bytes = 0;
 
     for_each_block([&](auto& block) {
-        bool block_has_live_cells = false;
+        // Blocks where every cell survived only need their marks cleared.
+        if (!block.has_unmarked_live_cells()) {
+            block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+                cell->set_marked(false);
+                ++live_cells;
+                live_cell_bytes += block.cell_size();
+            });
+            block.did_clear_marks();
+            return IterationDecision::Continue;
+        }
+
+        bool block_has_live_cells = block.has_marked_cells();
         bool block_was_full = block.is_full();
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked()) {
@@ -484,11 +521,11 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
                 collected_cell_bytes += block.cell_size();
             } else {
                 cell->set_marked(false);
-                block_has_live_cells = true;
                 ++live_cells;
                 live_cell_bytes += block.cell_size();
             }
         });
+        block.did_clear_marks();
         if (!block_has_live_cells)
             empty_blocks.append(&block);
         else if (block_was_full != block.is_full())
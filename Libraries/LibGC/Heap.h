@@ -8,11 +8,13 @@
 
 #include <AK/Badge.h>
 #include <AK/Function.h>
+#include <AK/HashTable.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/StackInfo.h>
 #include <AK/Swift.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
@@ -53,6 +55,12 @@ public:
     };
 
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
+
+    // Collects garbage early if a sizable fraction of the allocation threshold has been used up since the last collection.
+    // Embedders should call this when they are idle, so that the collection pause happens between tasks instead of in the
+    // middle of whichever allocation would otherwise cross the threshold. Nothing is collected if the previous collection
+    // was too recent, or took longer than the time left until the idle period ends.
+    void collect_garbage_if_idle_threshold_reached(AK::Duration time_until_idle_deadline);
     AK::JsonObject dump_graph();
 
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
@@ -75,6 +83,9 @@ public:
 
     void register_cell_allocator(Badge<CellAllocator>, CellAllocator&);
 
+    void did_create_heap_block(Badge<CellAllocator>, HeapBlock&);
+    void did_destroy_heap_block(Badge<CellAllocator>, HeapBlock&);
+
     void uproot_cell(Cell* cell);
 
     bool is_gc_deferred() const { return m_gc_deferrals > 0; }
@@ -135,14 +146,23 @@ private:
     }
 
     static constexpr size_t GC_MIN_BYTES_THRESHOLD { 4 * 1024 * 1024 };
+    static constexpr size_t GC_IDLE_THRESHOLD_DIVISOR { 2 };
+    static constexpr AK::Duration GC_IDLE_MINIMUM_INTERVAL { AK::Duration::from_seconds(1) };
     size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
     size_t m_allocated_bytes_since_last_gc { 0 };
 
+    Optional<MonotonicTime> m_last_collection_end_time;
+    AK::Duration m_last_collection_duration;
+
     bool m_should_collect_on_every_allocation { false };
 
     Vector<NonnullOwnPtr<CellAllocator>> m_size_based_cell_allocators;
     CellAllocator::List m_all_cell_allocators;
 
+    // Kept up to date as blocks come and go, so that conservative pointer checks during marking don't have to
+    // rebuild it from every allocator on every collection.
+    HashTable<HeapBlock*> m_live_heap_blocks;
+
     RootImpl::List m_roots;
     RootVectorBase::List m_root_vectors;
     RootHashMapBase::List m_root_hash_maps;
@@ -226,4 +246,14 @@ inline void Heap::register_cell_allocator(Badge<CellAllocator>, CellAllocator& a
     m_all_cell_allocators.append(allocator);
 }
 
+inline void Heap::did_create_heap_block(Badge<CellAllocator>, HeapBlock& block)
+{
+    m_live_heap_blocks.set(&block);
+}
+
+inline void Heap::did_destroy_heap_block(Badge<CellAllocator>, HeapBlock& block)
+{
+    m_live_heap_blocks.remove(&block);
+}
+
 }
@@ -44,12 +44,21 @@ public:
 
         if (allocated_cell) {
             ASAN_UNPOISON_MEMORY_REGION(allocated_cell, m_cell_size);
+            ++m_live_cell_count;
         }
         return allocated_cell;
     }
 
     void deallocate(Cell*);
 
+    // The marker keeps track of how many cells it has marked in each block, so that the finalization and sweep
+    // phases can tell which blocks have no garbage in them without looking at every cell.
+    void did_mark_cell() { ++m_marked_cell_count; }
+    void did_unmark_cell() { --m_marked_cell_count; }
+    void did_clear_marks() { m_marked_cell_count = 0; }
+    bool has_unmarked_live_cells() const { return m_marked_cell_count < m_live_cell_count; }
+    bool has_marked_cells() const { return m_marked_cell_count > 0; }
+
     template<typename Callback>
     void for_each_cell(Callback callback)
     {
@@ -111,6 +120,8 @@ private:
     CellAllocator& m_cell_allocator;
     size_t m_cell_size { 0 };
     size_t m_next_lazy_freelist_index { 0 };
+    size_t m_live_cell_count { 0 };
+    size_t m_marked_cell_count { 0 };
     Ptr<FreelistEntry> m_freelist;
     alignas(__BIGGEST_ALIGNMENT__) u8 m_storage[];
 
@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/NeverDestroyed.h>
 #include <AK/TypeCasts.h>
 #include <AK/Utf16String.h>
 #include <LibGfx/Font/Font.h>
@@ -126,18 +127,112 @@ SkFont Font::skia_font(float scale) const
     return sk_font;
 }
 
+using ShapingCacheLRUList = IntrusiveList<&Font::ShapingCache::Entry::lru_list_node>;
+
+static ShapingCacheLRUList& shaping_cache_lru_list()
+{
+    // NOTE: Fonts may outlive any static list, e.g. when they're owned by the FontDatabase.
+    static NeverDestroyed<ShapingCacheLRUList> list;
+    return *list;
+}
+
+static size_t s_shaping_cache_total_size_in_bytes { 0 };
+
+Font::ShapingCache::Entry::~Entry()
+{
+    shaping_cache_lru_list().remove(*this);
+    s_shaping_cache_total_size_in_bytes -= size_in_bytes;
+    hb_buffer_destroy(buffer);
+}
+
 Font::ShapingCache::~ShapingCache()
 {
     clear();
 }
 
-void Font::ShapingCache::clear()
+static Optional<size_t> single_ascii_character_index(Utf16View const& string)
+{
+    if (string.length_in_code_units() != 1)
+        return {};
+    auto code_unit = string.code_unit_at(0);
+    if (code_unit >= 128)
+        return {};
+    return code_unit;
+}
+
+hb_buffer_t* Font::ShapingCache::get(Utf16View const& string, ShapeFeatures const& features)
+{
+    if (auto index = single_ascii_character_index(string); index.has_value() && m_single_ascii_character_features.has_value() && *m_single_ascii_character_features == features) {
+        if (auto* buffer = m_single_ascii_character_buffers[*index])
+            return buffer;
+    }
+
+    auto it = m_entries.find(string.hash(), [&](auto& candidate) { return candidate.key == string; });
+    if (it == m_entries.end())
+        return nullptr;
+
+    for (auto& entry : it->value) {
+        if (entry->features != features)
+            continue;
+        shaping_cache_lru_list().append(*entry);
+        return entry->buffer;
+    }
+    return nullptr;
+}
+
+void Font::ShapingCache::set(Utf16View const& string, ShapeFeatures const& features, hb_buffer_t* buffer)
 {
-    for (auto& it : map) {
-        hb_buffer_destroy(it.value);
+    if (auto index = single_ascii_character_index(string); index.has_value()) {
+        if (!m_single_ascii_character_features.has_value())
+            m_single_ascii_character_features = features;
+        if (*m_single_ascii_character_features == features) {
+            VERIFY(!m_single_ascii_character_buffers[*index]);
+            m_single_ascii_character_buffers[*index] = buffer;
+            return;
+        }
+    }
+
+    VERIFY(string.length_in_code_units() <= maximum_cacheable_length_in_code_units);
+
+    auto text = Utf16String::from_utf16(string);
+    auto glyph_count = hb_buffer_get_length(buffer);
+    auto entry = adopt_own(*new Entry {
+        .cache = *this,
+        .text = text,
+        .features = features,
+        .buffer = buffer,
+        .size_in_bytes = sizeof(Entry) + (string.length_in_code_units() * sizeof(char16_t)) + (glyph_count * (sizeof(hb_glyph_info_t) + sizeof(hb_glyph_position_t))),
+        .lru_list_node = {},
+    });
+
+    auto& lru_list = shaping_cache_lru_list();
+    lru_list.append(*entry);
+    s_shaping_cache_total_size_in_bytes += entry->size_in_bytes;
+    m_entries.ensure(text).append(move(entry));
+
+    while (s_shaping_cache_total_size_in_bytes > maximum_total_size_in_bytes) {
+        auto* least_recently_used_entry = lru_list.first();
+        if (!least_recently_used_entry || least_recently_used_entry->buffer == buffer)
+            break;
+        least_recently_used_entry->cache.remove(*least_recently_used_entry);
     }
-    map.clear();
-    for (auto& buffer : single_ascii_character_map) {
+}
+
+void Font::ShapingCache::remove(Entry& entry)
+{
+    auto it = m_entries.find(entry.text);
+    VERIFY(it != m_entries.end());
+
+    it->value.remove_first_matching([&](auto& candidate) { return candidate.ptr() == &entry; });
+    if (it->value.is_empty())
+        m_entries.remove(it);
+}
+
+void Font::ShapingCache::clear()
+{
+    m_entries.clear();
+    m_single_ascii_character_features.clear();
+    for (auto& buffer : m_single_ascii_character_buffers) {
         if (buffer) {
             hb_buffer_destroy(buffer);
             buffer = nullptr;
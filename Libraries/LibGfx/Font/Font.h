@@ -10,6 +10,8 @@
 #pragma once
 
 #include <AK/FlyString.h>
+#include <AK/HashMap.h>
+#include <AK/IntrusiveList.h>
 #include <AK/Utf16String.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/Typeface.h>
@@ -83,15 +85,45 @@ public:
     Font const& bold_variant() const;
     hb_font_t* harfbuzz_font() const;
 
-    struct ShapingCache {
-        // Before using the cache, make sure the features match! If they don't, clear the cache.
-        ShapeFeatures features;
-
-        HashMap<Utf16String, hb_buffer_t*> map;
-        hb_buffer_t* single_ascii_character_map[128] { nullptr };
+    // Caches the results of shaping text with this font, keyed by the text and the features it was shaped with.
+    // Since fonts are shared per typeface and size, so are their caches. Entries of all fonts are accounted against one
+    // memory budget, and the least recently used ones are evicted once it's exceeded.
+    class ShapingCache {
+    public:
+        // Long runs of text rarely repeat, so we only cache word-sized ones.
+        static constexpr size_t maximum_cacheable_length_in_code_units = 64;
+        static constexpr size_t maximum_total_size_in_bytes = 8 * MiB;
 
+        ShapingCache() = default;
         ~ShapingCache();
+
+        hb_buffer_t* get(Utf16View const&, ShapeFeatures const&);
+
+        // Takes ownership of the buffer.
+        void set(Utf16View const&, ShapeFeatures const&, hb_buffer_t*);
+
         void clear();
+
+        struct Entry {
+            ~Entry();
+
+            ShapingCache& cache;
+            Utf16String text;
+            ShapeFeatures features;
+            hb_buffer_t* buffer { nullptr };
+            size_t size_in_bytes { 0 };
+            IntrusiveListNode<Entry> lru_list_node;
+        };
+
+    private:
+        void remove(Entry&);
+
+        HashMap<Utf16String, Vector<NonnullOwnPtr<Entry>, 1>> m_entries;
+
+        // Single ASCII characters are shaped very often, so they skip the map (and the memory budget) for the first set
+        // of features they're shaped with.
+        Optional<ShapeFeatures> m_single_ascii_character_features;
+        hb_buffer_t* m_single_ascii_character_buffers[128] { nullptr };
     };
     ShapingCache& shaping_cache() const { return m_shaping_cache; }
 
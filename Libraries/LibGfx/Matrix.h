@@ -65,6 +65,8 @@ public:
     constexpr auto const& operator[](size_t row, size_t col) const { return m_elements[row][col]; }
     constexpr auto& operator[](size_t row, size_t col) { return m_elements[row][col]; }
 
+    [[nodiscard]] constexpr bool operator==(Matrix const&) const = default;
+
     [[nodiscard]] constexpr Matrix operator*(Matrix const& other) const
     {
         Matrix product;
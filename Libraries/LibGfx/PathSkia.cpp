@@ -211,6 +211,11 @@ bool PathImplSkia::is_empty() const
     return m_path->isEmpty();
 }
 
+bool PathImplSkia::equals(PathImpl const& other) const
+{
+    return *m_path == static_cast<PathImplSkia const&>(other).sk_path();
+}
+
 Gfx::FloatPoint PathImplSkia::last_point() const
 {
     SkPoint last {};
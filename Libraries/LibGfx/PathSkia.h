@@ -38,6 +38,7 @@ public:
     virtual Gfx::FloatPoint last_point() const override;
     virtual Gfx::FloatRect bounding_box() const override;
     virtual bool contains(FloatPoint point, Gfx::WindingRule) const override;
+    [[nodiscard]] virtual bool equals(PathImpl const&) const override;
     virtual void set_fill_type(Gfx::WindingRule winding_rule) override;
 
     virtual NonnullOwnPtr<PathImpl> clone() const override;
@@ -7,6 +7,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ScopeGuard.h>
 #include <AK/Utf16String.h>
 #include <AK/Utf16View.h>
 #include <LibGfx/Point.h>
@@ -104,35 +105,20 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
     auto const& metrics = font.pixel_metrics();
     auto& shaping_cache = font.shaping_cache();
 
-    // NOTE: We only cache shaping results for a specific set of features. If the features change, we clear the cache.
-    if (shaping_cache.features != features) {
-        shaping_cache.clear();
-        shaping_cache.features = features;
-    }
-
-    // FIXME: The cache currently grows unbounded. We should have some limit and LRU mechanism.
-    auto get_or_create_buffer = [&] -> hb_buffer_t* {
-        if (string.length_in_code_units() == 1) {
-            auto code_unit = string.code_unit_at(0);
-            if (code_unit < 128) {
-                auto*& cache_slot = shaping_cache.single_ascii_character_map[code_unit];
-                if (!cache_slot) {
-                    cache_slot = setup_text_shaping(string, font, features);
-                }
-                return cache_slot;
-            }
+    auto* buffer = shaping_cache.get(string, features);
+    auto buffer_is_cached = buffer != nullptr;
+    if (!buffer) {
+        buffer = setup_text_shaping(string, font, features);
+        if (string.length_in_code_units() <= Font::ShapingCache::maximum_cacheable_length_in_code_units) {
+            shaping_cache.set(string, features, buffer);
+            buffer_is_cached = true;
         }
-        if (auto it = shaping_cache.map.find(
-                string.hash(), [&](auto& candidate) { return candidate.key == string; });
-            it != shaping_cache.map.end()) {
-            return it->value;
-        }
-        auto* buffer = setup_text_shaping(string, font, features);
-        shaping_cache.map.set(Utf16String::from_utf16(string), buffer);
-        return buffer;
+    }
+    ScopeGuard destroy_uncached_buffer = [&] {
+        if (!buffer_is_cached)
+            hb_buffer_destroy(buffer);
     };
 
-    hb_buffer_t* buffer = get_or_create_buffer();
     u32 glyph_count;
     auto const* glyph_info = hb_buffer_get_glyph_infos(buffer, &glyph_count);
     auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
@@ -215,6 +215,41 @@ CodeGenerationErrorOr<void> Generator::emit_function_declaration_instantiation(E
     return {};
 }
 
+static bool is_jump(Instruction::Type type)
+{
+    switch (type) {
+    case Instruction::Type::Jump:
+    case Instruction::Type::JumpIf:
+    case Instruction::Type::JumpTrue:
+    case Instruction::Type::JumpFalse:
+    case Instruction::Type::JumpNullish:
+    case Instruction::Type::JumpUndefined:
+#define __JS_COMPARISON_JUMP_CASE(op_TitleCase, op_snake_case, numeric_operator) \
+    case Instruction::Type::Jump##op_TitleCase:
+        JS_ENUMERATE_COMPARISON_OPS(__JS_COMPARISON_JUMP_CASE)
+#undef __JS_COMPARISON_JUMP_CASE
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Follows unconditional jumps through blocks that contain nothing else, and returns the index of the block where such a chain ends.
+static u32 final_jump_target(Vector<NonnullOwnPtr<BasicBlock>> const& blocks, size_t block_index)
+{
+    // NOTE: The number of hops is bounded so that an empty infinite loop like `for (;;) {}` doesn't keep us here forever.
+    for (size_t hops = 0; hops < blocks.size(); ++hops) {
+        auto const& block = *blocks[block_index];
+        if (!block.is_terminated() || block.size() != sizeof(Op::Jump))
+            break;
+        auto const& instruction = *reinterpret_cast<Instruction const*>(block.data());
+        if (instruction.type() != Instruction::Type::Jump)
+            break;
+        block_index = static_cast<Op::Jump const&>(instruction).target().basic_block_index();
+    }
+    return block_index;
+}
+
 CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode const& node, FunctionKind enclosing_function_kind, GC::Ptr<ECMAScriptFunctionObject const> function, MustPropagateCompletion must_propagate_completion, Vector<LocalVariable> local_variable_names)
 {
     Generator generator(vm, function, must_propagate_completion);
@@ -361,6 +396,13 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         while (!it.at_end()) {
             auto& instruction = const_cast<Instruction&>(*it);
 
+            // OPTIMIZATION: Jumps to a block that does nothing but jump somewhere else can go straight to the final destination.
+            if (is_jump(instruction.type())) {
+                instruction.visit_labels([&](Label& label) {
+                    label = Label { final_jump_target(generator.m_root_basic_blocks, label.basic_block_index()) };
+                });
+            }
+
             if (instruction.type() == Instruction::Type::Jump) {
                 auto& jump = static_cast<Bytecode::Op::Jump&>(instruction);
 
@@ -1288,8 +1330,8 @@ void Generator::emit_jump_if(ScopedOperand const& condition, Label true_target,
 {
     if (condition.operand().is_constant()) {
         auto value = m_constants[condition.operand().index()];
-        if (value.is_boolean()) {
-            if (value.as_bool()) {
+        if (!value.is_special_empty_value()) {
+            if (value.to_boolean()) {
                 emit<Op::Jump>(true_target);
             } else {
                 emit<Op::Jump>(false_target);
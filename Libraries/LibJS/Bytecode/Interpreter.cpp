@@ -125,6 +125,8 @@ ALWAYS_INLINE static ThrowCompletionOr<bool> loosely_inequals(VM& vm, Value src1
         if (src1.is_int32() || src1.is_object() || src1.is_boolean() || src1.is_nullish())
             return src1.encoded() != src2.encoded();
     }
+    if (src1.is_number() && src2.is_number())
+        return src1.as_double() != src2.as_double();
     return !TRY(is_loosely_equal(vm, src1, src2));
 }
 
@@ -134,6 +136,8 @@ ALWAYS_INLINE static ThrowCompletionOr<bool> loosely_equals(VM& vm, Value src1,
         if (src1.is_int32() || src1.is_object() || src1.is_boolean() || src1.is_nullish())
             return src1.encoded() == src2.encoded();
     }
+    if (src1.is_number() && src2.is_number())
+        return src1.as_double() == src2.as_double();
     return TRY(is_loosely_equal(vm, src1, src2));
 }
 
@@ -143,6 +147,8 @@ ALWAYS_INLINE static ThrowCompletionOr<bool> strict_inequals(VM&, Value src1, Va
         if (src1.is_int32() || src1.is_object() || src1.is_boolean() || src1.is_nullish())
             return src1.encoded() != src2.encoded();
     }
+    if (src1.is_number() && src2.is_number())
+        return src1.as_double() != src2.as_double();
     return !is_strictly_equal(src1, src2);
 }
 
@@ -152,6 +158,8 @@ ALWAYS_INLINE static ThrowCompletionOr<bool> strict_equals(VM&, Value src1, Valu
         if (src1.is_int32() || src1.is_object() || src1.is_boolean() || src1.is_nullish())
             return src1.encoded() == src2.encoded();
     }
+    if (src1.is_number() && src2.is_number())
+        return src1.as_double() == src2.as_double();
     return is_strictly_equal(src1, src2);
 }
 
@@ -1427,11 +1435,12 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<Utf16Fl
         if (storage
             && storage->is_simple_storage()
             && !object.may_interfere_with_indexed_property_access()) {
-            auto maybe_value = storage->get(index);
+            auto& simple_storage = static_cast<SimpleIndexedPropertyStorage&>(*storage);
+            auto maybe_value = simple_storage.inline_get(index);
             if (maybe_value.has_value()) {
-                auto existing_value = maybe_value->value;
-                if (!existing_value.is_accessor()) {
-                    storage->put(index, value);
+                // NOTE: Storage that only contains numbers can't have any accessors in it.
+                if (simple_storage.contains_only_numbers() || !maybe_value->value.is_accessor()) {
+                    simple_storage.put(index, value);
                     return {};
                 }
             }
@@ -2015,6 +2024,42 @@ ThrowCompletionOr<void> Sub::execute_impl(Bytecode::Interpreter& interpreter) co
     return {};
 }
 
+ThrowCompletionOr<void> Div::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto const lhs = interpreter.get(m_lhs);
+    auto const rhs = interpreter.get(m_rhs);
+
+    if (lhs.is_number() && rhs.is_number()) {
+        interpreter.set(m_dst, Value(lhs.as_double() / rhs.as_double()));
+        return {};
+    }
+
+    interpreter.set(m_dst, TRY(div(vm, lhs, rhs)));
+    return {};
+}
+
+ThrowCompletionOr<void> Mod::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto const lhs = interpreter.get(m_lhs);
+    auto const rhs = interpreter.get(m_rhs);
+
+    if (lhs.is_number() && rhs.is_number()) {
+        // NOTE: A negative dividend can produce -0, which is not representable as an i32, so only the
+        //       non-negative case is done with integer arithmetic.
+        if (lhs.is_int32() && rhs.is_int32() && lhs.as_i32() >= 0 && rhs.as_i32() > 0) {
+            interpreter.set(m_dst, Value(lhs.as_i32() % rhs.as_i32()));
+            return {};
+        }
+        interpreter.set(m_dst, Value(fmod(lhs.as_double(), rhs.as_double())));
+        return {};
+    }
+
+    interpreter.set(m_dst, TRY(mod(vm, lhs, rhs)));
+    return {};
+}
+
 ThrowCompletionOr<void> BitwiseXor::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
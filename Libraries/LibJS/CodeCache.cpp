@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/CodeCache.h>
+#include <LibJS/SourceCode.h>
+
+namespace JS {
+
+// Small scripts are quick to parse and not worth holding on to.
+static constexpr size_t minimum_cacheable_source_size_in_bytes = 1 * KiB;
+
+// The budget only counts source text, but each entry also keeps its parse tree and any bytecode compiled for it alive,
+// which take up several times as much memory. Capping the number of entries keeps that bounded as well.
+static constexpr size_t maximum_entry_count = 64;
+
+void CodeCache::set_maximum_source_size_in_bytes(size_t maximum_source_size_in_bytes)
+{
+    m_maximum_source_size_in_bytes = maximum_source_size_in_bytes;
+    evict_entries_over_budget();
+}
+
+RefPtr<Program> CodeCache::find(Program::Type type, StringView partition, StringView filename, size_t line_number_offset, StringView source_text)
+{
+    if (m_entries.is_empty())
+        return nullptr;
+
+    auto source_text_hash = source_text.hash();
+    for (auto& entry : m_entries) {
+        if (entry.source_text_hash != source_text_hash || entry.type != type || entry.line_number_offset != line_number_offset)
+            continue;
+        if (entry.partition != partition)
+            continue;
+
+        auto const& source_code = entry.program->source_code();
+        if (source_code.filename() != filename || source_code.code().utf16_view() != source_text)
+            continue;
+
+        entry.last_use = ++m_use_counter;
+        return entry.program;
+    }
+    return nullptr;
+}
+
+void CodeCache::add(Program::Type type, String partition, size_t line_number_offset, StringView source_text, NonnullRefPtr<Program> program)
+{
+    if (source_text.length() < minimum_cacheable_source_size_in_bytes || source_text.length() > m_maximum_source_size_in_bytes)
+        return;
+
+    m_entries.append({
+        .type = type,
+        .partition = move(partition),
+        .line_number_offset = line_number_offset,
+        .source_text_hash = source_text.hash(),
+        .source_size_in_bytes = source_text.length(),
+        .program = move(program),
+        .last_use = ++m_use_counter,
+    });
+    m_source_size_in_bytes += source_text.length();
+
+    evict_entries_over_budget();
+}
+
+void CodeCache::evict_entries_over_budget()
+{
+    while (m_source_size_in_bytes > m_maximum_source_size_in_bytes || m_entries.size() > maximum_entry_count) {
+        VERIFY(!m_entries.is_empty());
+
+        size_t least_recently_used_index = 0;
+        for (size_t i = 1; i < m_entries.size(); ++i) {
+            if (m_entries[i].last_use < m_entries[least_recently_used_index].last_use)
+                least_recently_used_index = i;
+        }
+
+        m_source_size_in_bytes -= m_entries[least_recently_used_index].source_size_in_bytes;
+        m_entries.remove(least_recently_used_index);
+    }
+}
+
+}
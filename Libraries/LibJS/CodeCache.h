@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibJS/AST.h>
+#include <LibJS/Export.h>
+
+namespace JS {
+
+// Keeps the parse trees of recently loaded scripts and modules around, so that loading the same source text again,
+// e.g. on the next visit to a page, doesn't have to parse it again. Functions keep their bytecode on the parse tree
+// once they've been compiled, so that is reused as well.
+//
+// Parse trees don't refer to anything that belongs to a specific realm, so they could be shared by scripts in any realm
+// of the same VM. Entries are only shared within a partition chosen by the host, though (see
+// VM::host_get_code_cache_partition), so that one site can't learn which scripts another one has loaded.
+class JS_API CodeCache {
+    AK_MAKE_NONCOPYABLE(CodeCache);
+    AK_MAKE_NONMOVABLE(CodeCache);
+
+public:
+    CodeCache() = default;
+
+    // Nothing is cached until the cache has been given a budget.
+    void set_maximum_source_size_in_bytes(size_t);
+
+    RefPtr<Program> find(Program::Type, StringView partition, StringView filename, size_t line_number_offset, StringView source_text);
+    void add(Program::Type, String partition, size_t line_number_offset, StringView source_text, NonnullRefPtr<Program>);
+
+private:
+    // NOTE: The filename and source text are compared against the program's own SourceCode, so they aren't copied.
+    struct Entry {
+        Program::Type type;
+        String partition;
+        size_t line_number_offset { 0 };
+        u32 source_text_hash { 0 };
+        size_t source_size_in_bytes { 0 };
+        NonnullRefPtr<Program> program;
+        u64 last_use { 0 };
+    };
+
+    void evict_entries_over_budget();
+
+    Vector<Entry> m_entries;
+    size_t m_source_size_in_bytes { 0 };
+    size_t m_maximum_source_size_in_bytes { 0 };
+    u64 m_use_counter { 0 };
+};
+
+}
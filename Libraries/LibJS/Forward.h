@@ -163,6 +163,7 @@ struct CachedSourceRange;
 class Cell;
 class ClassExpression;
 struct ClassFieldDefinition;
+class CodeCache;
 class Completion;
 class Console;
 class CyclicModule;
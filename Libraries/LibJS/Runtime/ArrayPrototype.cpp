@@ -109,6 +109,22 @@ void ArrayPrototype::initialize(Realm& realm)
     define_direct_property(vm.well_known_symbol_unscopables(), unscopable_list, Attribute::Configurable);
 }
 
+// Returns the storage of an array that only contains numbers, if its elements can be read straight from that storage:
+// no proxy traps or getters can run, and holes can't be filled in by indexed properties on the prototype chain.
+static SimpleIndexedPropertyStorage const* storage_of_array_with_only_numbers(Object& object)
+{
+    auto* array = as_if<Array>(object);
+    if (!array || array->is_proxy_target() || array->may_interfere_with_indexed_property_access() || !array->default_prototype_chain_intact())
+        return nullptr;
+    auto const* storage = array->indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return nullptr;
+    auto const& simple_storage = static_cast<SimpleIndexedPropertyStorage const&>(*storage);
+    if (!simple_storage.contains_only_numbers())
+        return nullptr;
+    return &simple_storage;
+}
+
 // 10.4.2.3 ArraySpeciesCreate ( originalArray, length ), https://tc39.es/ecma262/#sec-arrayspeciescreate
 static ThrowCompletionOr<Object*> array_species_create(VM& vm, Object& original_array, size_t length)
 {
@@ -742,6 +758,23 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    // OPTIMIZATION: Search arrays that only contain numbers for a number without going through [[Get]] for every element.
+    //               Holes and elements past the end of the storage read as undefined, which never matches a number.
+    if (auto const* storage = storage_of_array_with_only_numbers(this_object); storage && value_to_find.is_number()) {
+        if (value_to_find.is_nan() && storage->element_kind() == SimpleIndexedPropertyStorage::ElementKind::Int32)
+            return Value(false);
+        auto elements = storage->elements().span();
+        auto end = min(length, storage->array_like_size());
+        auto number_to_find = value_to_find.as_double();
+        for (u64 i = from_index; i < end; ++i) {
+            auto element = elements[i];
+            if (element.is_number() && (element.as_double() == number_to_find || (element.is_nan() && value_to_find.is_nan())))
+                return Value(true);
+        }
+        return Value(false);
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -795,6 +828,19 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    // OPTIMIZATION: Search arrays that only contain numbers for a number without going through [[Get]] for every element.
+    if (auto const* storage = storage_of_array_with_only_numbers(object); storage && search_element.is_number()) {
+        auto elements = storage->elements().span();
+        auto end = min(length, storage->array_like_size());
+        auto number_to_find = search_element.as_double();
+        for (; k < end; ++k) {
+            auto element = elements[k];
+            if (element.is_number() && element.as_double() == number_to_find)
+                return Value(k);
+        }
+        return Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -906,6 +952,18 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::last_index_of)
         k = (double)length + n;
     }
 
+    // OPTIMIZATION: Search arrays that only contain numbers for a number without going through [[Get]] for every element.
+    if (auto const* storage = storage_of_array_with_only_numbers(object); storage && search_element.is_number()) {
+        auto elements = storage->elements().span();
+        auto number_to_find = search_element.as_double();
+        for (k = min(k, static_cast<ssize_t>(storage->array_like_size()) - 1); k >= 0; --k) {
+            auto element = elements[k];
+            if (element.is_number() && element.as_double() == number_to_find)
+                return Value((size_t)k);
+        }
+        return Value(-1);
+    }
+
     // 8. Repeat, while k ≥ 0,
     for (; k >= 0; --k) {
         auto property_key = PropertyKey { k };
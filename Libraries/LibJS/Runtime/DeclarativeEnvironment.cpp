@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/Error.h>
@@ -15,6 +16,13 @@ namespace JS {
 
 GC_DEFINE_ALLOCATOR(DeclarativeEnvironment);
 
+u64 DeclarativeEnvironment::allocate_environment_serial_number_range()
+{
+    // The low 32 bits are left for counting binding changes within a single environment.
+    static Atomic<u64> s_next_range { 1 };
+    return s_next_range.fetch_add(1, AK::MemoryOrder::memory_order_relaxed) << 32;
+}
+
 DeclarativeEnvironment* DeclarativeEnvironment::create_for_per_iteration_bindings(Badge<ForStatement>, DeclarativeEnvironment& other, size_t bindings_size)
 {
     auto bindings = other.m_bindings.span().slice(0, bindings_size);
@@ -129,7 +129,13 @@ private:
     HashMap<Utf16FlyString, size_t> m_bindings_assoc;
     DisposeCapability m_dispose_capability;
 
-    u64 m_environment_serial_number { 0 };
+    static u64 allocate_environment_serial_number_range();
+
+    // NOTE: Each environment counts its serial number up from the start of a range of its own. Caches keyed by the
+    //       serial number can outlive the environment they were filled from (e.g. bytecode of a cached script that is
+    //       run again in another realm), so two environments that had the same number of bindings created must not
+    //       end up with the same serial number.
+    u64 m_environment_serial_number { allocate_environment_serial_number_range() };
 };
 
 inline ThrowCompletionOr<Value> DeclarativeEnvironment::get_binding_value_direct(VM& vm, size_t index) const
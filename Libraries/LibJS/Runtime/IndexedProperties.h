@@ -62,6 +62,14 @@ private:
 
 class SimpleIndexedPropertyStorage final : public IndexedPropertyStorage {
 public:
+    // The most general kind of value that has been stored so far. Storing a more general value moves the storage over
+    // to that kind, but it never goes back to a narrower one. Holes don't count towards the element kind.
+    enum class ElementKind : u8 {
+        Int32,
+        Number,
+        Any,
+    };
+
     SimpleIndexedPropertyStorage()
         : IndexedPropertyStorage(IsSimpleStorage::Yes)
     {
@@ -95,13 +103,27 @@ public:
 
     bool has_empty_elements() const { return m_number_of_empty_elements.value() > 0; }
 
+    ElementKind element_kind() const { return m_element_kind; }
+    bool contains_only_numbers() const { return m_element_kind != ElementKind::Any; }
+
 private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
 
+    ALWAYS_INLINE void update_element_kind(Value value)
+    {
+        if (m_element_kind == ElementKind::Any || value.is_int32())
+            return;
+        if (value.is_number())
+            m_element_kind = ElementKind::Number;
+        else if (!value.is_special_empty_value())
+            m_element_kind = ElementKind::Any;
+    }
+
     Checked<size_t> m_number_of_empty_elements { 0 };
     Vector<Value> m_packed_elements;
+    ElementKind m_element_kind { ElementKind::Int32 };
 };
 
 class GenericIndexedPropertyStorage final : public IndexedPropertyStorage {
@@ -180,6 +202,16 @@ public:
 
     size_t real_size() const;
 
+    // Values that are known to only be numbers don't have to be visited by the garbage collector.
+    bool contains_only_numbers() const
+    {
+        if (!m_storage)
+            return true;
+        if (!m_storage->is_simple_storage())
+            return false;
+        return static_cast<SimpleIndexedPropertyStorage const&>(*m_storage).contains_only_numbers();
+    }
+
     Vector<u32> indices() const;
 
     template<typename Callback>
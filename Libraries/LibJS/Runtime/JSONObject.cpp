@@ -4,11 +4,15 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/CharacterTypes.h>
 #include <AK/Function.h>
+#include <AK/GenericLexer.h>
+#include <AK/HashMap.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
 #include <AK/StringBuilder.h>
+#include <AK/StringConversions.h>
 #include <AK/TypeCasts.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
@@ -414,6 +418,283 @@ String JSONObject::quote_json_string(Utf16View const& string)
     return builder.to_string_without_validation();
 }
 
+// Parses JSON text straight into JS values, without building an intermediate AK::JsonValue tree first.
+// Accepts exactly the same inputs as AK::JsonParser.
+class JSONParser : private GenericLexer {
+public:
+    JSONParser(VM& vm, StringView text)
+        : GenericLexer(text)
+        , m_vm(vm)
+        , m_realm(*vm.current_realm())
+    {
+    }
+
+    ThrowCompletionOr<Value> parse()
+    {
+        auto value = TRY(parse_value());
+        ignore_while(is_json_whitespace);
+        if (!is_eof())
+            return syntax_error();
+        return value;
+    }
+
+private:
+    struct JSONString {
+        StringView view;
+
+        // Strings without escape sequences are views into the input, all others only live until the next string is read.
+        bool is_view_into_input { true };
+    };
+
+    static constexpr bool is_json_whitespace(char ch)
+    {
+        return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' ';
+    }
+
+    Completion syntax_error()
+    {
+        return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+    }
+
+    ThrowCompletionOr<Value> parse_value()
+    {
+        ignore_while(is_json_whitespace);
+        switch (peek()) {
+        case '{':
+            return parse_object();
+        case '[':
+            return parse_array();
+        case '"':
+            return PrimitiveString::create(m_vm, TRY(consume_string()).view);
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+            return parse_number();
+        case 't':
+            if (consume_specific("true"sv))
+                return Value(true);
+            break;
+        case 'f':
+            if (consume_specific("false"sv))
+                return Value(false);
+            break;
+        case 'n':
+            if (consume_specific("null"sv))
+                return js_null();
+            break;
+        }
+        return syntax_error();
+    }
+
+    ThrowCompletionOr<Value> parse_object()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        ignore(); // '{'
+        auto object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+
+        ignore_while(is_json_whitespace);
+        if (consume_specific('}'))
+            return object;
+
+        for (;;) {
+            ignore_while(is_json_whitespace);
+            if (peek() != '"')
+                return syntax_error();
+            auto property_key = TRY(consume_property_key());
+
+            ignore_while(is_json_whitespace);
+            if (!consume_specific(':'))
+                return syntax_error();
+
+            // NOTE: Objects with the same keys in the same order end up sharing the same chain of cached shape transitions.
+            auto value = TRY(parse_value());
+            object->define_direct_property(property_key, value, default_attributes);
+
+            ignore_while(is_json_whitespace);
+            if (consume_specific('}'))
+                return object;
+            if (!consume_specific(','))
+                return syntax_error();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_array()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        ignore(); // '['
+        auto array = MUST(Array::create(m_realm, 0));
+
+        ignore_while(is_json_whitespace);
+        if (consume_specific(']'))
+            return array;
+
+        for (;;) {
+            auto value = TRY(parse_value());
+            array->indexed_properties().append(value);
+
+            ignore_while(is_json_whitespace);
+            if (consume_specific(']'))
+                return array;
+            if (!consume_specific(','))
+                return syntax_error();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_number()
+    {
+        auto start = tell();
+        bool negative = consume_specific('-');
+
+        u64 integer = 0;
+        size_t digit_count = 0;
+        if (!is_ascii_digit(peek()))
+            return syntax_error();
+        if (!consume_specific('0')) {
+            while (is_ascii_digit(peek())) {
+                integer = integer * 10 + parse_ascii_digit(consume());
+                ++digit_count;
+            }
+        }
+
+        bool is_integer = true;
+        if (consume_specific('.')) {
+            if (!is_ascii_digit(peek()))
+                return syntax_error();
+            ignore_while(is_ascii_digit);
+            is_integer = false;
+        }
+        if (consume_specific('e') || consume_specific('E')) {
+            if (!consume_specific('+'))
+                consume_specific('-');
+            if (!is_ascii_digit(peek()))
+                return syntax_error();
+            ignore_while(is_ascii_digit);
+            is_integer = false;
+        }
+
+        // OPTIMIZATION: Integers with up to 15 digits are always exactly representable as a double.
+        if (is_integer && digit_count <= 15) {
+            auto value = static_cast<double>(integer);
+            return Value(negative ? -value : value);
+        }
+
+        auto number_text = m_input.substring_view(start, tell() - start);
+        auto result = parse_first_number<double>(number_text, TrimWhitespace::No);
+        if (!result.has_value() || result->characters_parsed != number_text.length())
+            return syntax_error();
+        return Value(result->value);
+    }
+
+    ThrowCompletionOr<JSONString> consume_string()
+    {
+        ignore(); // '"'
+        auto start = tell();
+
+        // OPTIMIZATION: Most strings don't contain any escape sequences, so they can be used exactly as they appear in the input.
+        for (;;) {
+            char ch = peek();
+            if (ch == '"') {
+                auto view = m_input.substring_view(start, tell() - start);
+                ignore();
+                return JSONString { view };
+            }
+            if (ch == '\\')
+                break;
+            // NOTE: We also get a 0 byte when we reach the end of the input.
+            if (is_ascii_c0_control(ch))
+                return syntax_error();
+            ++m_index;
+        }
+
+        m_string_builder.clear();
+        m_string_builder.append(m_input.substring_view(start, tell() - start));
+
+        for (;;) {
+            size_t literal_characters = 0;
+            for (;;) {
+                char ch = peek(literal_characters);
+                if (is_ascii_c0_control(ch))
+                    return syntax_error();
+                if (ch == '"' || ch == '\\')
+                    break;
+                ++literal_characters;
+            }
+            m_string_builder.append(consume(literal_characters));
+
+            if (consume_specific('"'))
+                return JSONString { m_string_builder.string_view(), false };
+
+            ignore(); // '\'
+            switch (peek()) {
+            case '"':
+            case '\\':
+            case '/':
+                m_string_builder.append(consume());
+                break;
+            case 'b':
+                ignore();
+                m_string_builder.append('\b');
+                break;
+            case 'f':
+                ignore();
+                m_string_builder.append('\f');
+                break;
+            case 'n':
+                ignore();
+                m_string_builder.append('\n');
+                break;
+            case 'r':
+                ignore();
+                m_string_builder.append('\r');
+                break;
+            case 't':
+                ignore();
+                m_string_builder.append('\t');
+                break;
+            case 'u': {
+                ignore();
+                auto code_point = decode_single_or_paired_surrogate();
+                if (code_point.is_error())
+                    return syntax_error();
+                m_string_builder.append_code_point(code_point.value());
+                break;
+            }
+            default:
+                return syntax_error();
+            }
+        }
+    }
+
+    ThrowCompletionOr<PropertyKey> consume_property_key()
+    {
+        auto name = TRY(consume_string());
+        if (!name.is_view_into_input)
+            return PropertyKey { Utf16String::from_utf8(name.view) };
+
+        // OPTIMIZATION: The same keys tend to show up over and over again, so each of them is only converted once.
+        return m_property_keys.ensure(name.view, [&] {
+            return PropertyKey { Utf16String::from_utf8(name.view) };
+        });
+    }
+
+    VM& m_vm;
+    Realm& m_realm;
+    StringBuilder m_string_builder;
+    HashMap<StringView, PropertyKey> m_property_keys;
+};
+
 // 25.5.1 JSON.parse ( text [ , reviver ] ), https://tc39.es/ecma262/#sec-json.parse
 JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
 {
@@ -450,18 +731,14 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
 // 25.5.1.1 ParseJSON ( text ), https://tc39.es/ecma262/#sec-ParseJSON
 ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
 {
-    auto json = JsonValue::from_string(text);
-
     // 1. If StringToCodePoints(text) is not a valid JSON text as specified in ECMA-404, throw a SyntaxError exception.
-    if (json.is_error())
-        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-
     // 2. Let scriptString be the string-concatenation of "(", text, and ");".
     // 3. Let script be ParseText(scriptString, Script).
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = JSONObject::parse_json_value(vm, json.value());
+    // NOTE: Validating the text and creating the values it describes both happen in a single pass over the text.
+    auto result = TRY(JSONParser(vm, text).parse());
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
@@ -1512,9 +1512,11 @@ void Object::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_shape);
     visitor.visit(m_storage);
 
-    m_indexed_properties.for_each_value([&visitor](auto& value) {
-        visitor.visit(value);
-    });
+    if (!m_indexed_properties.contains_only_numbers()) {
+        m_indexed_properties.for_each_value([&visitor](auto& value) {
+            visitor.visit(value);
+        });
+    }
 
     if (m_private_elements) {
         for (auto& private_element : *m_private_elements)
@@ -16,6 +16,7 @@
 #include <LibFileSystem/FileSystem.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/CodeCache.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
@@ -70,6 +71,7 @@ VM::VM(ErrorMessages error_messages)
     , m_error_messages(move(error_messages))
 {
     m_bytecode_interpreter = make<Bytecode::Interpreter>(*this);
+    m_code_cache = make<CodeCache>();
 
     m_empty_string = m_heap.allocate<PrimitiveString>(String {});
 
@@ -209,6 +211,11 @@ VM::VM(ErrorMessages error_messages)
         return nanoseconds;
     };
 
+    // Without a host to tell realms apart, every realm shares a single partition of the code cache.
+    host_get_code_cache_partition = [](Realm&) -> Optional<String> {
+        return String {};
+    };
+
     // AD-HOC: Inform the host that we received a date string we were unable to parse.
     host_unrecognized_date_string = [](StringView) {
     };
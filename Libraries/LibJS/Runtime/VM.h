@@ -63,6 +63,8 @@ public:
 
     Bytecode::Interpreter& bytecode_interpreter() { return *m_bytecode_interpreter; }
 
+    CodeCache& code_cache() { return *m_code_cache; }
+
     void dump_backtrace() const;
 
     void gather_roots(HashMap<GC::Cell*, GC::HeapRoot>&);
@@ -302,6 +304,10 @@ public:
     Function<ThrowCompletionOr<void>(Realm&, NonnullOwnPtr<ExecutionContext>, ShadowRealm&)> host_initialize_shadow_realm;
     Function<Crypto::SignedBigInteger(Object const& global)> host_system_utc_epoch_nanoseconds;
 
+    // Returns the partition of the code cache that scripts parsed in the given realm may share, or nothing if they
+    // shouldn't be cached at all.
+    Function<Optional<String>(Realm&)> host_get_code_cache_partition;
+
     Vector<StackTraceElement> stack_trace() const;
 
 private:
@@ -331,6 +337,9 @@ private:
 
     GC::Heap m_heap;
 
+    // NOTE: Cached parse trees keep their bytecode alive, so they have to go away before the heap.
+    OwnPtr<CodeCache> m_code_cache;
+
     Vector<ExecutionContext*> m_execution_context_stack;
 
     Vector<Vector<ExecutionContext*>> m_saved_execution_context_stacks;
@@ -5,6 +5,7 @@
  */
 
 #include <LibJS/AST.h>
+#include <LibJS/CodeCache.h>
 #include <LibJS/Lexer.h>
 #include <LibJS/Parser.h>
 #include <LibJS/Runtime/VM.h>
@@ -17,16 +18,28 @@ GC_DEFINE_ALLOCATOR(Script);
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
+    auto& vm = realm.vm();
+    auto& code_cache = vm.code_cache();
+    auto code_cache_partition = vm.host_get_code_cache_partition(realm);
+
     // 1. Let script be ParseText(sourceText, Script).
-    auto parser = Parser(Lexer(source_text, filename, line_number_offset));
-    auto script = parser.parse_program();
+    RefPtr<Program> script;
+    if (code_cache_partition.has_value())
+        script = code_cache.find(Program::Type::Script, *code_cache_partition, filename, line_number_offset, source_text);
+    if (!script) {
+        auto parser = Parser(Lexer(source_text, filename, line_number_offset));
+        script = parser.parse_program();
+
+        // 2. If script is a List of errors, return body.
+        if (parser.has_errors())
+            return parser.errors();
 
-    // 2. If script is a List of errors, return body.
-    if (parser.has_errors())
-        return parser.errors();
+        if (code_cache_partition.has_value())
+            code_cache.add(Program::Type::Script, code_cache_partition.release_value(), line_number_offset, source_text, *script);
+    }
 
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
-    return realm.heap().allocate<Script>(realm, filename, move(script), host_defined);
+    return realm.heap().allocate<Script>(realm, filename, script.release_nonnull(), host_defined);
 }
 
 Script::Script(Realm& realm, StringView filename, NonnullRefPtr<Program> parse_node, HostDefined* host_defined)
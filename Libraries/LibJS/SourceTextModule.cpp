@@ -8,6 +8,7 @@
 #include <AK/Debug.h>
 #include <AK/QuickSort.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/CodeCache.h>
 #include <LibJS/Parser.h>
 #include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
@@ -131,13 +132,25 @@ void SourceTextModule::visit_edges(Cell::Visitor& visitor)
 // 16.2.1.7.1 ParseModule ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parsemodule
 Result<GC::Ref<SourceTextModule>, Vector<ParserError>> SourceTextModule::parse(StringView source_text, Realm& realm, StringView filename, Script::HostDefined* host_defined)
 {
-    // 1. Let body be ParseText(sourceText, Module).
-    auto parser = Parser(Lexer(source_text, filename), Program::Type::Module);
-    auto body = parser.parse_program();
+    auto& vm = realm.vm();
+    auto& code_cache = vm.code_cache();
+    auto code_cache_partition = vm.host_get_code_cache_partition(realm);
 
-    // 2. If body is a List of errors, return body.
-    if (parser.has_errors())
-        return parser.errors();
+    // 1. Let body be ParseText(sourceText, Module).
+    RefPtr<Program> body;
+    if (code_cache_partition.has_value())
+        body = code_cache.find(Program::Type::Module, *code_cache_partition, filename, 1, source_text);
+    if (!body) {
+        auto parser = Parser(Lexer(source_text, filename), Program::Type::Module);
+        body = parser.parse_program();
+
+        // 2. If body is a List of errors, return body.
+        if (parser.has_errors())
+            return parser.errors();
+
+        if (code_cache_partition.has_value())
+            code_cache.add(Program::Type::Module, code_cache_partition.release_value(), 1, source_text, *body);
+    }
 
     // 3. Let requestedModules be the ModuleRequests of body.
     auto requested_modules = module_requests(*body);
@@ -252,7 +265,7 @@ Result<GC::Ref<SourceTextModule>, Vector<ParserError>> SourceTextModule::parse(S
         filename,
         host_defined,
         async,
-        move(body),
+        body.release_nonnull(),
         move(requested_modules),
         move(import_entries),
         move(local_export_entries),
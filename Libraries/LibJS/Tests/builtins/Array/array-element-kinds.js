@@ -0,0 +1,84 @@
+describe("searching arrays that only contain numbers", () => {
+    test("int32 elements", () => {
+        const array = [1, 2, 3, 2, 1];
+        expect(array.indexOf(2)).toBe(1);
+        expect(array.indexOf(2.0)).toBe(1);
+        expect(array.indexOf(2, 2)).toBe(3);
+        expect(array.indexOf(4)).toBe(-1);
+        expect(array.indexOf("2")).toBe(-1);
+        expect(array.lastIndexOf(2)).toBe(3);
+        expect(array.lastIndexOf(2, 2)).toBe(1);
+        expect(array.lastIndexOf(1, -1)).toBe(4);
+        expect(array.includes(3)).toBeTrue();
+        expect(array.includes(3, 3)).toBeFalse();
+        expect(array.includes(NaN)).toBeFalse();
+    });
+
+    test("double elements", () => {
+        const array = [0.5, NaN, -0, Infinity];
+        expect(array.indexOf(0.5)).toBe(0);
+        expect(array.indexOf(NaN)).toBe(-1);
+        expect(array.lastIndexOf(NaN)).toBe(-1);
+        expect(array.includes(NaN)).toBeTrue();
+        expect(array.indexOf(0)).toBe(2);
+        expect(array.includes(+0)).toBeTrue();
+        expect(array.lastIndexOf(Infinity)).toBe(3);
+    });
+
+    test("holes", () => {
+        const array = [1, , 3];
+        expect(array.indexOf(undefined)).toBe(-1);
+        expect(array.includes(undefined)).toBeTrue();
+        expect(array.indexOf(3)).toBe(2);
+        expect(array.lastIndexOf(1)).toBe(0);
+    });
+
+    test("holes filled in by the prototype", () => {
+        const array = [1, , 3];
+        Array.prototype[1] = 2;
+        try {
+            expect(array.indexOf(2)).toBe(1);
+            expect(array.lastIndexOf(2)).toBe(1);
+            expect(array.includes(2)).toBeTrue();
+        } finally {
+            delete Array.prototype[1];
+        }
+    });
+
+    test("array shrinks while converting fromIndex", () => {
+        const array = [1, 2, 3, 4];
+        const fromIndex = {
+            valueOf() {
+                array.length = 1;
+                return 0;
+            },
+        };
+        expect(array.indexOf(4, fromIndex)).toBe(-1);
+        array.push(2, 3, 4);
+        expect(array.includes(4, fromIndex)).toBeFalse();
+        array.push(2, 3, 4);
+        expect(array.lastIndexOf(4, fromIndex)).toBe(-1);
+    });
+});
+
+describe("element kind transitions", () => {
+    test("storing other kinds of values", () => {
+        const array = [1, 2, 3];
+        array[1] = 1.5;
+        expect(array.indexOf(1.5)).toBe(1);
+        array[2] = "three";
+        expect(array.indexOf("three")).toBe(2);
+        expect(array.indexOf(1)).toBe(0);
+        array[2] = 3;
+        expect(array.indexOf(3)).toBe(2);
+        expect(array).toEqual([1, 1.5, 3]);
+    });
+
+    test("objects stored into a number array stay alive", () => {
+        const array = [];
+        for (let i = 0; i < 100; ++i) array.push(i);
+        array[50] = { value: 50 };
+        gc();
+        expect(array[50].value).toBe(50);
+    });
+});
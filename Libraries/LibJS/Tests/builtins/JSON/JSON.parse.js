@@ -74,3 +74,57 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("strings", () => {
+    expect(JSON.parse('"\\"\\\\\\/\\b\\f\\n\\r\\t"')).toBe('"\\/\b\f\n\r\t');
+    expect(JSON.parse('"\\u0041\\u00e9\\ud834\\udd1e"')).toBe("Aé𝄞");
+    expect(JSON.parse('"héllo wörld"')).toBe("héllo wörld");
+    expect(JSON.parse('{"a\\u0062c":"d\\ne"}')).toEqual({ abc: "d\ne" });
+
+    ['"\\x41"', '"\\u00"', '"abc', '"a\nb"', '"\\'].forEach(text => {
+        expect(() => JSON.parse(text)).toThrow(SyntaxError);
+    });
+});
+
+test("numbers", () => {
+    expect(JSON.parse("[0, -1, 1.5, -2.25e2, 1E3, 1e-2, 123456789012345]")).toEqual([
+        0, -1, 1.5, -225, 1000, 0.01, 123456789012345,
+    ]);
+
+    ["01", "-", "1.", ".5", "1e", "1e+", "+1", "--1", "0x10"].forEach(text => {
+        expect(() => JSON.parse(text)).toThrow(SyntaxError);
+    });
+});
+
+test("whitespace", () => {
+    expect(JSON.parse(' \t\n\r[ 1 ,\t{ "a" :\r\n2 } ]\n')).toEqual([1, { a: 2 }]);
+
+    // Only tab, line feed, carriage return and space are JSON whitespace.
+    ["\v1", "\f1", "1\v", "1\f", "[1,\v2]", "\u00a01", "\u20281"].forEach(text => {
+        expect(() => JSON.parse(text)).toThrow(SyntaxError);
+    });
+});
+
+test("object keys", () => {
+    const object = JSON.parse('{"b":1,"a":2,"0":3,"b":4,"__proto__":5}');
+    expect(Object.keys(object)).toEqual(["0", "b", "a", "__proto__"]);
+    expect(object.b).toBe(4);
+    expect(object[0]).toBe(3);
+    expect(Object.getPrototypeOf(object)).toBe(Object.prototype);
+    expect(Object.getOwnPropertyDescriptor(object, "__proto__").value).toBe(5);
+});
+
+test("objects with the same keys", () => {
+    const objects = JSON.parse('[{"x":1,"y":2},{"x":3,"y":4},{"y":5,"x":6}]');
+    expect(objects).toEqual([
+        { x: 1, y: 2 },
+        { x: 3, y: 4 },
+        { y: 5, x: 6 },
+    ]);
+    expect(Object.keys(objects[2])).toEqual(["y", "x"]);
+});
+
+test("deeply nested input", () => {
+    const depth = 1000000;
+    expect(() => JSON.parse("[".repeat(depth) + "]".repeat(depth))).toThrow(InternalError);
+});
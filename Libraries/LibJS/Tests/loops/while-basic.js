@@ -23,3 +23,30 @@ test("exception in test expression", () => {
         while (foo);
     }).toThrow(ReferenceError);
 });
+
+test("constant non-boolean test expression", () => {
+    let number = 0;
+    while (1) {
+        if (++number === 3) break;
+    }
+    expect(number).toBe(3);
+
+    while ("") {
+        expect().fail();
+    }
+
+    while (null) {
+        expect().fail();
+    }
+});
+
+test("nested loops with empty continuation blocks", () => {
+    let count = 0;
+    for (let i = 0; i < 3; ++i) {
+        for (let j = 0; j < 3; ++j) {
+            if (j === i) continue;
+            ++count;
+        }
+    }
+    expect(count).toBe(6);
+});
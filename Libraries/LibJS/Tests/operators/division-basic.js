@@ -0,0 +1,47 @@
+// NOTE: Operands are passed through a function, so that the division happens at runtime.
+const divide = (lhs, rhs) => lhs / rhs;
+
+test("basic functionality", () => {
+    expect(divide(6, 3)).toBe(2);
+    expect(divide(7, 2)).toBe(3.5);
+    expect(divide(-7, 2)).toBe(-3.5);
+    expect(divide(0.75, 0.25)).toBe(3);
+    expect(divide("6", 3)).toBe(2);
+    expect(divide(6, "3")).toBe(2);
+});
+
+test("division by zero", () => {
+    expect(divide(1, 0)).toBe(Infinity);
+    expect(divide(-1, 0)).toBe(-Infinity);
+    expect(divide(1, -0)).toBe(-Infinity);
+    expect(divide(-1, -0)).toBe(Infinity);
+    expect(divide(1.5, 0)).toBe(Infinity);
+    expect(divide(0, 0)).toBeNaN();
+    expect(divide(-0, 0)).toBeNaN();
+    expect(divide(0, -0)).toBeNaN();
+});
+
+test("NaN operands", () => {
+    expect(divide(NaN, 1)).toBeNaN();
+    expect(divide(1, NaN)).toBeNaN();
+    expect(divide(NaN, NaN)).toBeNaN();
+    expect(divide(NaN, 0)).toBeNaN();
+    expect(divide(Infinity, Infinity)).toBeNaN();
+    expect(divide(undefined, 1)).toBeNaN();
+});
+
+test("int32 operands with results that aren't int32", () => {
+    expect(divide(1, 3)).toBe(1 / 3);
+    expect(Number.isInteger(divide(1, 3))).toBeFalse();
+    expect(divide(2147483647, 2)).toBe(1073741823.5);
+
+    // The quotient is outside of the int32 range.
+    expect(divide(-2147483648, -1)).toBe(2147483648);
+
+    // Zero quotients keep the sign of the operands.
+    expect(Object.is(divide(0, 1), 0)).toBeTrue();
+    expect(Object.is(divide(-0, 1), -0)).toBeTrue();
+    expect(Object.is(divide(0, -1), -0)).toBeTrue();
+    expect(Object.is(divide(-0, -1), 0)).toBeTrue();
+    expect(divide(1, divide(0, -1))).toBe(-Infinity);
+});
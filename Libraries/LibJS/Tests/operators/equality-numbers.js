@@ -0,0 +1,76 @@
+// NOTE: Operands are passed through a function, so that the comparison happens at runtime. Comparisons used as a
+//       condition are compiled to conditional jumps, so those are tested separately.
+const looselyEquals = (lhs, rhs) => lhs == rhs;
+const looselyInequals = (lhs, rhs) => lhs != rhs;
+const strictlyEquals = (lhs, rhs) => lhs === rhs;
+const strictlyInequals = (lhs, rhs) => lhs !== rhs;
+
+const looselyEqualsJump = (lhs, rhs) => {
+    if (lhs == rhs) return true;
+    return false;
+};
+const looselyInequalsJump = (lhs, rhs) => {
+    if (lhs != rhs) return true;
+    return false;
+};
+const strictlyEqualsJump = (lhs, rhs) => {
+    if (lhs === rhs) return true;
+    return false;
+};
+const strictlyInequalsJump = (lhs, rhs) => {
+    if (lhs !== rhs) return true;
+    return false;
+};
+
+const equals = [looselyEquals, strictlyEquals, looselyEqualsJump, strictlyEqualsJump];
+const inequals = [looselyInequals, strictlyInequals, looselyInequalsJump, strictlyInequalsJump];
+
+test("NaN", () => {
+    for (const compare of equals) {
+        expect(compare(NaN, NaN)).toBeFalse();
+        expect(compare(NaN, 0)).toBeFalse();
+        expect(compare(1.5, NaN)).toBeFalse();
+    }
+    for (const compare of inequals) {
+        expect(compare(NaN, NaN)).toBeTrue();
+        expect(compare(NaN, 0)).toBeTrue();
+        expect(compare(1.5, NaN)).toBeTrue();
+    }
+});
+
+test("zeros", () => {
+    for (const compare of equals) {
+        expect(compare(0, -0)).toBeTrue();
+        expect(compare(-0, 0)).toBeTrue();
+        expect(compare(-0, -0)).toBeTrue();
+    }
+    for (const compare of inequals) {
+        expect(compare(0, -0)).toBeFalse();
+        expect(compare(-0, 0)).toBeFalse();
+    }
+});
+
+test("int32 and double operands", () => {
+    for (const compare of equals) {
+        expect(compare(1, 1)).toBeTrue();
+        expect(compare(1, 1.0)).toBeTrue();
+        expect(compare(0.5 + 0.5, 1)).toBeTrue();
+        expect(compare(1, 1.5)).toBeFalse();
+        expect(compare(Infinity, Infinity)).toBeTrue();
+        expect(compare(Infinity, -Infinity)).toBeFalse();
+    }
+    for (const compare of inequals) {
+        expect(compare(0.5 + 0.5, 1)).toBeFalse();
+        expect(compare(1, 1.5)).toBeTrue();
+    }
+});
+
+test("numbers compared to other types", () => {
+    expect(looselyEquals(1, "1")).toBeTrue();
+    expect(strictlyEquals(1, "1")).toBeFalse();
+    expect(looselyEqualsJump(0, false)).toBeTrue();
+    expect(strictlyEqualsJump(0, false)).toBeFalse();
+    expect(looselyInequals(NaN, "NaN")).toBeTrue();
+    expect(strictlyInequals(1, 1n)).toBeTrue();
+    expect(looselyEquals(1, 1n)).toBeTrue();
+});
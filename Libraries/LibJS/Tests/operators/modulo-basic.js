@@ -37,3 +37,15 @@ test("basic functionality", () => {
     expect(undefined % undefined).toBeNaN();
     expect(null % null).toBeNaN();
 });
+
+test("int32 operands", () => {
+    const values = [0, 1, 2, 3, 7, -1, -7, 2147483647, -2147483648];
+    for (const lhs of values) {
+        for (const rhs of values) {
+            const expected = lhs - rhs * Math.trunc(lhs / rhs);
+            if (rhs === 0) expect(lhs % rhs).toBeNaN();
+            else if (expected === 0 && (lhs < 0 || Object.is(lhs, -0))) expect(lhs % rhs).toBe(-0);
+            else expect(lhs % rhs).toBe(expected);
+        }
+    }
+});
@@ -14,6 +14,8 @@
 #include <AK/Error.h>
 #include <AK/FlyString.h>
 #include <AK/MemMem.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/StringBuilder.h>
 #include <AK/StringView.h>
 #include <AK/Utf16String.h>
@@ -25,6 +27,47 @@
 
 namespace regex {
 
+namespace Detail {
+
+// Returns the offset of the first code unit at or after start_offset that is one of the given ASCII characters,
+// comparing a whole vector of code units against each character at a time.
+template<typename CodeUnit>
+Optional<size_t> find_first_of_ascii(ReadonlySpan<CodeUnit> haystack, ReadonlySpan<char> characters, size_t start_offset)
+{
+    using CodeUnitVector = Conditional<sizeof(CodeUnit) == 1, AK::SIMD::u8x16, AK::SIMD::u16x8>;
+    using Element = AK::SIMD::ElementOf<CodeUnitVector>;
+    static constexpr size_t lanes = AK::SIMD::vector_length<CodeUnitVector>;
+
+    size_t offset = start_offset;
+    for (; offset + lanes <= haystack.size(); offset += lanes) {
+        auto chunk = AK::SIMD::load_unaligned<CodeUnitVector>(haystack.offset_pointer(offset));
+
+        decltype(chunk == chunk) matches {};
+        for (auto character : characters)
+            matches |= chunk == static_cast<Element>(character);
+
+        auto words = bit_cast<AK::SIMD::u64x2>(matches);
+        if ((words[0] | words[1]) == 0)
+            continue;
+
+        for (size_t i = 0; i < lanes; ++i) {
+            if (matches[i])
+                return offset + i;
+        }
+    }
+
+    for (; offset < haystack.size(); ++offset) {
+        for (auto character : characters) {
+            if (static_cast<Element>(haystack[offset]) == static_cast<Element>(character))
+                return offset;
+        }
+    }
+
+    return {};
+}
+
+}
+
 class RegexStringView {
 public:
     RegexStringView() = default;
@@ -297,6 +340,45 @@ public:
             [&](StringView view) { return view.starts_with(str); });
     }
 
+    // Returns the code unit offset of the first code unit at or after start_offset that is one of the given ASCII characters.
+    Optional<size_t> find_first_of_ascii(ReadonlySpan<char> characters, size_t start_offset) const
+    {
+        return m_view.visit(
+            [&](StringView view) { return Detail::find_first_of_ascii(view.bytes(), characters, start_offset); },
+            [&](Utf16View const& view) {
+                if (view.has_ascii_storage())
+                    return Detail::find_first_of_ascii(view.ascii_span(), characters, start_offset);
+                return Detail::find_first_of_ascii(view.utf16_span(), characters, start_offset);
+            });
+    }
+
+    // Returns the code unit offset of the first occurrence of the given non-empty ASCII string at or after start_offset.
+    Optional<size_t> find_ascii_string(StringView needle, size_t start_offset) const
+    {
+        VERIFY(!needle.is_empty());
+
+        return m_view.visit(
+            [&](StringView view) { return view.find(needle, start_offset); },
+            [&](Utf16View const& view) -> Optional<size_t> {
+                auto first_code_unit = static_cast<char16_t>(needle[0]);
+                auto length = view.length_in_code_units();
+
+                for (auto offset = view.find_code_unit_offset(first_code_unit, start_offset); offset.has_value(); offset = view.find_code_unit_offset(first_code_unit, *offset + 1)) {
+                    if (*offset + needle.length() > length)
+                        return {};
+
+                    size_t i = 1;
+                    for (; i < needle.length(); ++i) {
+                        if (view.code_unit_at(*offset + i) != static_cast<char16_t>(needle[i]))
+                            break;
+                    }
+                    if (i == needle.length())
+                        return offset;
+                }
+                return {};
+            });
+    }
+
 private:
     NO_UNIQUE_ADDRESS Variant<StringView, Utf16View> m_view { StringView {} };
     NO_UNIQUE_ADDRESS bool m_unicode { false };
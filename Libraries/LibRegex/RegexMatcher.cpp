@@ -211,6 +211,23 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
     auto only_start_of_line = m_pattern->parser_result.optimization_data.only_start_of_line && !input.regex_options.has_flag_set(AllFlags::Multiline);
 
+    // If the whole pattern is a literal string, we can jump straight to its next occurrence instead of trying to match
+    // at every position in between. This is only valid when we're free to move the starting position (i.e. not sticky).
+    Optional<StringView> literal_to_search_for;
+    if (auto const& literal = m_pattern->parser_result.optimization_data.pure_substring_search; literal.has_value() && continue_search) {
+        if (!literal->is_empty() && literal->view().is_ascii() && !input.regex_options.has_flag_set(AllFlags::Insensitive))
+            literal_to_search_for = literal->view();
+    }
+
+    // Likewise, if every match has to start with one of a few ASCII characters, scan ahead for the next one of those.
+    Optional<ReadonlySpan<char>> starting_ascii_characters;
+    if (continue_search && !only_start_of_line && !literal_to_search_for.has_value()) {
+        auto const& optimization_data = m_pattern->parser_result.optimization_data;
+        auto const& characters = input.regex_options.has_flag_set(AllFlags::Insensitive) ? optimization_data.starting_ascii_characters_insensitive : optimization_data.starting_ascii_characters;
+        if (!characters.is_empty())
+            starting_ascii_characters = characters.span();
+    }
+
     auto compare_range = [insensitive = input.regex_options & AllFlags::Insensitive](auto needle, CharRange range) {
         auto upper_case_needle = needle;
         auto lower_case_needle = needle;
@@ -278,6 +295,20 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
                     break;
             }
 
+            auto const insensitive = input.regex_options.has_flag_set(AllFlags::Insensitive);
+
+            if (literal_to_search_for.has_value()) {
+                auto next_occurrence = input.view.find_ascii_string(*literal_to_search_for, view_index);
+                if (!next_occurrence.has_value())
+                    break;
+                view_index = *next_occurrence;
+            } else if (starting_ascii_characters.has_value()) {
+                auto next_candidate = input.view.find_first_of_ascii(*starting_ascii_characters, view_index);
+                if (!next_candidate.has_value())
+                    break;
+                view_index = *next_candidate;
+            }
+
             // FIXME: More performant would be to know the remaining minimum string
             //        length needed to match from the current position onwards within
             //        the vm. Add new OpCode for MinMatchLengthFromSp with the value of
@@ -288,8 +319,8 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             if (match_length_minimum && match_length_minimum > view_length - view_index)
                 break;
 
-            auto const insensitive = input.regex_options.has_flag_set(AllFlags::Insensitive);
-            if (auto& starting_ranges = m_pattern->parser_result.optimization_data.starting_ranges; !starting_ranges.is_empty()) {
+            // If we scanned for the starting characters above, we've already landed on one of them.
+            if (auto& starting_ranges = m_pattern->parser_result.optimization_data.starting_ranges; !starting_ascii_characters.has_value() && !starting_ranges.is_empty()) {
                 auto ranges = insensitive ? m_pattern->parser_result.optimization_data.starting_ranges_insensitive.span() : starting_ranges.span();
                 auto ch = input.view.unicode_aware_code_point_at(view_index);
                 if (insensitive)
@@ -232,6 +232,7 @@ private:
     void attempt_rewrite_loops_as_atomic_groups(BasicBlockList const&);
     bool attempt_rewrite_entire_match_as_substring_search(BasicBlockList const&);
     void fill_optimization_data(BasicBlockList const&);
+    void fill_starting_ascii_characters();
 };
 
 // free standing functions for match, search and has_match
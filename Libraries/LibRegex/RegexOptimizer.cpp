@@ -228,6 +228,7 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
                 parser_result.optimization_data.starting_ranges_insensitive.append({ to_ascii_lowercase(it.key()), to_ascii_lowercase(*it) });
                 quick_sort(parser_result.optimization_data.starting_ranges_insensitive, [](CharRange a, CharRange b) { return a.from < b.from; });
             }
+            fill_starting_ascii_characters();
             return;
         }
         case OpCodeId::CheckBegin:
@@ -246,6 +247,37 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
     }
 }
 
+template<typename Parser>
+void Regex<Parser>::fill_starting_ascii_characters()
+{
+    // Scanning for more than a handful of characters at once is no faster than checking the starting ranges.
+    static constexpr size_t max_starting_ascii_characters = 8;
+
+    auto& optimization_data = parser_result.optimization_data;
+
+    Vector<char> characters;
+    Vector<char> characters_insensitive;
+    for (auto range : optimization_data.starting_ranges) {
+        if (range.to > 0x7f || range.to - range.from >= max_starting_ascii_characters)
+            return;
+
+        for (auto code_point = range.from; code_point <= range.to; ++code_point) {
+            characters.append(static_cast<char>(code_point));
+            for (auto insensitive_code_point : { to_ascii_lowercase(code_point), to_ascii_uppercase(code_point) }) {
+                if (!characters_insensitive.contains_slow(static_cast<char>(insensitive_code_point)))
+                    characters_insensitive.append(static_cast<char>(insensitive_code_point));
+            }
+        }
+
+        if (characters.size() > max_starting_ascii_characters)
+            return;
+    }
+
+    optimization_data.starting_ascii_characters = move(characters);
+    if (characters_insensitive.size() <= max_starting_ascii_characters)
+        optimization_data.starting_ascii_characters_insensitive = move(characters_insensitive);
+}
+
 template<typename Parser>
 typename Regex<Parser>::BasicBlockList Regex<Parser>::split_basic_blocks(ByteCode const& bytecode)
 {
@@ -67,6 +67,9 @@ public:
             // If populated, the pattern only accepts strings that start with a character in these ranges.
             Vector<CharRange> starting_ranges;
             Vector<CharRange> starting_ranges_insensitive;
+            // If populated, the starting ranges consist of only these few ASCII characters, which can be scanned for directly.
+            Vector<char> starting_ascii_characters;
+            Vector<char> starting_ascii_characters_insensitive;
             bool only_start_of_line = false;
         } optimization_data {};
     };
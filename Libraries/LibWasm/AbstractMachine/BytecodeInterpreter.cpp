@@ -1033,6 +1033,18 @@ HANDLE_INSTRUCTION(synthetic_i32_add2local)
     TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
+HANDLE_INSTRUCTION(synthetic_i32_sub2local)
+{
+    configuration.push_to_destination(Value(static_cast<i32>(Operators::Subtract {}(configuration.local(instruction->local_index()).to<u32>(), configuration.local(instruction->arguments().get<LocalIndex>()).to<u32>()))), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(synthetic_i32_mul2local)
+{
+    configuration.push_to_destination(Value(static_cast<i32>(Operators::Multiply {}(configuration.local(instruction->local_index()).to<u32>(), configuration.local(instruction->arguments().get<LocalIndex>()).to<u32>()))), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
 HANDLE_INSTRUCTION(synthetic_i32_addconstlocal)
 {
     configuration.push_to_destination(Value(static_cast<i32>(Operators::Add {}(configuration.local(instruction->local_index()).to<u32>(), instruction->arguments().unsafe_get<i32>()))), addresses.destination);
@@ -4036,6 +4048,17 @@ double BytecodeInterpreter::read_value<double>(ReadonlyBytes data)
     return bit_cast<double>(read_value<u64>(data));
 }
 
+static Optional<OpCode> fused_two_local_i32_opcode(OpCode opcode)
+{
+    if (opcode == Instructions::i32_add)
+        return Instructions::synthetic_i32_add2local;
+    if (opcode == Instructions::i32_sub)
+        return Instructions::synthetic_i32_sub2local;
+    if (opcode == Instructions::i32_mul)
+        return Instructions::synthetic_i32_mul2local;
+    return {};
+}
+
 CompiledInstructions try_compile_instructions(Expression const& expression, Span<FunctionType const> functions)
 {
     CompiledInstructions result;
@@ -4119,13 +4142,13 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
             }
             break;
         case InsnPatternState::GetLocalx2:
-            if (instruction.opcode() == Instructions::i32_add) {
-                // `local.get a; local.get b; i32.add` -> `i32.add_2local a b`.
-                // Replace the previous two ops with noops, and add i32.add_2local.
+            if (auto fused_opcode = fused_two_local_i32_opcode(instruction.opcode()); fused_opcode.has_value()) {
+                // `local.get a; local.get b; i32.<op>` -> `i32.<op>_2local a b`.
+                // Replace the previous two ops with noops, and add i32.<op>_2local.
                 result.dispatches[result.dispatches.size() - 1] = default_dispatch(nop);
                 result.dispatches[result.dispatches.size() - 2] = default_dispatch(nop);
                 result.extra_instruction_storage.append(Instruction {
-                    Instructions::synthetic_i32_add2local,
+                    *fused_opcode,
                     local_index_0,
                     local_index_1,
                 });
@@ -4213,7 +4236,7 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
                 i32_const_value = instruction.arguments().get<i32>();
                 pattern_state = InsnPatternState::GetLocalI32Const;
             } else if (instruction.opcode() == Instructions::local_get) {
-                swap(local_index_0, local_index_1);
+                // The local we just saw is the first operand, the new one is the second.
                 local_index_1 = instruction.local_index();
                 pattern_state = InsnPatternState::GetLocalx2;
             } else if (instruction.opcode() == Instructions::i32_add) {
@@ -474,7 +474,9 @@ namespace Instructions {
     M(synthetic_call_21, 0xfe0000000000000bull, 2, 1)            \
     M(synthetic_call_30, 0xfe0000000000000cull, 3, 0)            \
     M(synthetic_call_31, 0xfe0000000000000dull, 3, 1)            \
-    M(synthetic_end_expression, 0xfe0000000000000eull, 0, 0)
+    M(synthetic_end_expression, 0xfe0000000000000eull, 0, 0)     \
+    M(synthetic_i32_sub2local, 0xfe0000000000000full, 0, 1)      \
+    M(synthetic_i32_mul2local, 0xfe00000000000010ull, 0, 1)
 
 #define ENUMERATE_WASM_OPCODES(M)         \
     ENUMERATE_SINGLE_BYTE_WASM_OPCODES(M) \
@@ -485,7 +487,7 @@ ENUMERATE_WASM_OPCODES(M)
 #undef M
 
 static constexpr inline OpCode SyntheticInstructionBase = 0xfe00000000000000ull;
-static constexpr inline size_t SyntheticInstructionCount = 15;
+static constexpr inline size_t SyntheticInstructionCount = 17;
 
 }
 
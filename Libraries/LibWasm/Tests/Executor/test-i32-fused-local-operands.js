@@ -0,0 +1,42 @@
+// The interpreter fuses `local.get a; local.get b; i32.<op>` into a single instruction, including when that pattern
+// follows an i32.const or a local.get. These functions use non-commutative operators, so swapped operands show up.
+describe("fused i32 operations keep their operand order", () => {
+    const bin = readBinaryWasmFile("Fixtures/Modules/i32-fused-local-operands.wasm");
+    const module = parseWebAssemblyModule(bin);
+
+    const call = (name, ...args) => module.invoke(module.getExport(name), ...args);
+
+    test("local.get a; local.get b; i32.sub", () => {
+        expect(call("sub_two_locals", 10, 3)).toBe(7);
+        expect(call("sub_two_locals", 3, 10)).toBe(-7);
+    });
+
+    test("i32.const c; local.get a; i32.sub", () => {
+        expect(call("sub_const_local", 10)).toBe(90);
+        expect(call("sub_const_local", 3)).toBe(97);
+    });
+
+    test("i32.const c; local.get a; local.get b; i32.sub", () => {
+        // 100 - (a - b)
+        expect(call("sub_after_const", 10, 3)).toBe(93);
+        expect(call("sub_after_const", 3, 10)).toBe(107);
+    });
+
+    test("i32.const c; local.get a; local.get b; i32.mul", () => {
+        // 2 - a * b
+        expect(call("mul_after_const", 10, 3)).toBe(-28);
+        expect(call("mul_after_const", 3, 10)).toBe(-28);
+    });
+
+    test("local.get b; i32.const c; local.get a; local.get b; i32.sub", () => {
+        // b - 3 * (a - b)
+        expect(call("sub_after_local_const", 10, 3)).toBe(-18);
+        expect(call("sub_after_local_const", 3, 10)).toBe(31);
+    });
+
+    test("local.get a; local.get b; i32.const c; local.get b; local.get a; i32.sub", () => {
+        // a - b * (5 + (b - a))
+        expect(call("sub_after_locals_const", 10, 3)).toBe(16);
+        expect(call("sub_after_locals_const", 3, 10)).toBe(-117);
+    });
+});
@@ -10,6 +10,7 @@
 
 #include <LibGC/DeferGC.h>
 #include <LibJS/AST.h>
+#include <LibJS/CodeCache.h>
 #include <LibJS/Module.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/Environment.h>
@@ -29,6 +30,7 @@
 #include <LibWeb/ContentSecurityPolicy/Directives/KeywordSources.h>
 #include <LibWeb/ContentSecurityPolicy/Directives/Names.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/Fetch/Infrastructure/NetworkPartitionKey.h>
 #include <LibWeb/HTML/CustomElements/CustomElementDefinition.h>
 #include <LibWeb/HTML/EventNames.h>
 #include <LibWeb/HTML/HTMLSlotElement.h>
@@ -108,6 +110,24 @@ void initialize_main_thread_vm(AgentType type)
     //       This avoids doing an exhaustive garbage collection on process exit.
     s_main_thread_vm->ref();
 
+    // Pages tend to load the same scripts over and over again (e.g. on reload or navigation within a site), so we keep
+    // their parse trees and compiled bytecode around for as long as this process lives.
+    s_main_thread_vm->code_cache().set_maximum_source_size_in_bytes(16 * MiB);
+
+    // AD-HOC: Cached scripts are only shared between realms with the same origin that would also share an HTTP cache
+    //         partition, so that a page can't tell from parse times which scripts another site has loaded.
+    s_main_thread_vm->host_get_code_cache_partition = [](JS::Realm& realm) -> Optional<String> {
+        auto& settings_object = HTML::principal_realm_settings_object(realm);
+        auto origin = settings_object.origin();
+        auto network_partition_key = Fetch::Infrastructure::determine_the_network_partition_key(settings_object);
+
+        // Opaque origins all serialize to "null", so they can't be told apart.
+        if (origin.is_opaque() || network_partition_key.top_level_origin.is_opaque())
+            return {};
+
+        return MUST(String::formatted("{} {}", network_partition_key.top_level_origin.serialize(), origin.serialize()));
+    };
+
     // 8.1.6.1 HostEnsureCanAddPrivateElement(O), https://html.spec.whatwg.org/multipage/webappapis.html#the-hostensurecanaddprivateelement-implementation
     s_main_thread_vm->host_ensure_can_add_private_element = [](JS::Object const& object) -> JS::ThrowCompletionOr<void> {
         // 1. If O is a WindowProxy object, or implements Location, then return ThrowCompletion(a new TypeError).
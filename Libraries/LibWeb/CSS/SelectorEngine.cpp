@@ -1216,6 +1216,54 @@ bool matches(CSS::Selector const& selector, int component_list_index, DOM::Eleme
     VERIFY_NOT_REACHED();
 }
 
+bool matches_pseudo_class_identically(CSS::PseudoClass pseudo_class, DOM::Element const& a, DOM::Element const& b)
+{
+    auto same = [&](auto predicate) { return predicate(a) == predicate(b); };
+
+    switch (pseudo_class) {
+    case CSS::PseudoClass::Link:
+    case CSS::PseudoClass::AnyLink:
+        return same([](auto const& element) { return element.matches_link_pseudo_class(); });
+    case CSS::PseudoClass::LocalLink:
+        return same([](auto const& element) { return element.matches_local_link_pseudo_class(); });
+    case CSS::PseudoClass::Visited:
+        return true;
+    case CSS::PseudoClass::Active:
+        return same([](auto const& element) { return element.is_active(); });
+    case CSS::PseudoClass::Hover:
+        return same([](auto const& element) { return matches_hover_pseudo_class(element); });
+    case CSS::PseudoClass::Focus:
+    case CSS::PseudoClass::FocusVisible:
+        return same([](auto const& element) { return element.is_focused(); })
+            && same([](auto const& element) { return element.should_indicate_focus(); });
+    case CSS::PseudoClass::FocusWithin: {
+        auto focused_area = a.document().focused_area();
+        return !focused_area || same([&](auto const& element) { return element.is_inclusive_ancestor_of(*focused_area); });
+    }
+    case CSS::PseudoClass::Target:
+        return same([](auto const& element) { return element.is_target(); });
+    case CSS::PseudoClass::Disabled:
+    case CSS::PseudoClass::Enabled:
+        return same([](auto const& element) { return element.matches_disabled_pseudo_class(); })
+            && same([](auto const& element) { return element.matches_enabled_pseudo_class(); });
+    case CSS::PseudoClass::Checked:
+    case CSS::PseudoClass::Unchecked:
+        return same([](auto const& element) { return element.matches_checked_pseudo_class(); })
+            && same([](auto const& element) { return element.matches_unchecked_pseudo_class(); });
+    case CSS::PseudoClass::Defined:
+        return same([](auto const& element) { return element.is_defined(); });
+    case CSS::PseudoClass::Heading:
+        return a.namespace_uri() == b.namespace_uri() && a.local_name() == b.local_name();
+    case CSS::PseudoClass::Is:
+    case CSS::PseudoClass::Where:
+    case CSS::PseudoClass::Not:
+        // NOTE: These only depend on their argument selectors, whose own pseudo-classes are accounted for separately.
+        return true;
+    default:
+        return false;
+    }
+}
+
 bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_match, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context);
 
 bool matches(CSS::Selector const& selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context, Optional<CSS::PseudoElement> pseudo_element, GC::Ptr<DOM::ParentNode const> scope, SelectorKind selector_kind, GC::Ptr<DOM::Element const> anchor)
@@ -26,4 +26,7 @@ struct MatchContext {
 
 bool matches(CSS::Selector const&, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context, Optional<CSS::PseudoElement> = {}, GC::Ptr<DOM::ParentNode const> scope = {}, SelectorKind selector_kind = SelectorKind::Normal, GC::Ptr<DOM::Element const> anchor = nullptr);
 
+// Returns true if the given pseudo-class is known to either match both elements or neither of them, regardless of its arguments.
+bool matches_pseudo_class_identically(CSS::PseudoClass, DOM::Element const&, DOM::Element const&);
+
 }
@@ -2429,13 +2429,39 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
 
     ScopeGuard guard { [&abstract_element]() { abstract_element.element().set_needs_style_update(false); } };
 
+    auto old_custom_properties = abstract_element.custom_properties();
+
+    // If a sibling is indistinguishable from this element as far as selector matching goes, it has the same cascaded
+    // values as we would compute here. Reuse them and skip straight to computing the values against our own parent.
+    if (mode == ComputeStyleMode::Normal && !abstract_element.pseudo_element().has_value()) {
+        if (auto sibling = find_sibling_to_share_cascaded_properties_with(abstract_element.element())) {
+            auto& element = abstract_element.element();
+            if (sibling->style_uses_attr_css_function())
+                element.set_style_uses_attr_css_function();
+            if (sibling->style_uses_var_css_function())
+                element.set_style_uses_var_css_function();
+
+            auto custom_properties = sibling->custom_properties({});
+            abstract_element.set_custom_properties(move(custom_properties));
+
+            auto cascaded_properties = sibling->cascaded_properties({});
+            abstract_element.set_cascaded_properties(cascaded_properties);
+
+            auto computed_properties = compute_properties(abstract_element, *cascaded_properties);
+            computed_properties->set_attempted_pseudo_class_matches(sibling->computed_properties()->attempted_pseudo_class_matches());
+
+            if (did_change_custom_properties.has_value() && abstract_element.custom_properties() != old_custom_properties)
+                *did_change_custom_properties = true;
+
+            return computed_properties;
+        }
+    }
+
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
     PseudoClassBitmap attempted_pseudo_class_matches;
     auto matching_rule_set = build_matching_rule_set(abstract_element, attempted_pseudo_class_matches, did_match_any_pseudo_element_rules, mode);
 
-    auto old_custom_properties = abstract_element.custom_properties();
-
     // Resolve all the CSS custom properties ("variables") for this element:
     if (!abstract_element.pseudo_element().has_value() || pseudo_element_supports_property(*abstract_element.pseudo_element(), PropertyID::Custom)) {
         OrderedHashMap<FlyString, StyleProperty> custom_properties;
@@ -2488,6 +2514,67 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
     return computed_properties;
 }
 
+// Only a handful of the closest preceding siblings are considered, since identical siblings tend to be adjacent.
+static constexpr size_t max_style_sharing_candidates = 8;
+
+GC::Ptr<DOM::Element const> StyleComputer::find_sibling_to_share_cascaded_properties_with(DOM::Element const& element) const
+{
+    // NOTE: Anything that lets selectors tell this element apart from a sibling rules out sharing:
+    //       inline style, shadow trees and slots, and rules that depend on the position among siblings.
+    if (element.inline_style() || element.is_shadow_host() || element.assigned_slot_internal() || element.use_pseudo_element().has_value())
+        return {};
+
+    auto attribute_count = element.attribute_list_size();
+
+    size_t candidates_checked = 0;
+    for (auto const* sibling = element.previous_element_sibling(); sibling && candidates_checked < max_style_sharing_candidates; sibling = sibling->previous_element_sibling(), ++candidates_checked) {
+        if (sibling->needs_style_update())
+            continue;
+        auto sibling_computed_properties = sibling->computed_properties();
+        if (!sibling_computed_properties || !sibling->cascaded_properties({}))
+            continue;
+
+        if (sibling->local_name() != element.local_name() || sibling->namespace_uri() != element.namespace_uri())
+            continue;
+        if (sibling->inline_style() || sibling->is_shadow_host() || sibling->assigned_slot_internal() || sibling->use_pseudo_element().has_value())
+            continue;
+
+        if (sibling->style_affected_by_structural_changes()
+            || sibling->affected_by_has_pseudo_class_in_subject_position()
+            || sibling->affected_by_has_pseudo_class_in_non_subject_position()
+            || sibling->affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+            continue;
+
+        // NOTE: Comparing every attribute covers the id, classes and anything attribute selectors or presentational hints can see.
+        if (sibling->attribute_list_size() != attribute_count)
+            continue;
+        bool attributes_are_equal = true;
+        element.for_each_attribute([&](DOM::Attr const& attribute) {
+            if (attributes_are_equal && sibling->get_attribute_ns(attribute.namespace_uri(), attribute.local_name()) != attribute.value())
+                attributes_are_equal = false;
+        });
+        if (!attributes_are_equal)
+            continue;
+
+        // Finally, any pseudo-class that was consulted while matching the sibling must give the same answer for this element.
+        auto const& attempted_pseudo_class_matches = sibling_computed_properties->attempted_pseudo_class_matches();
+        bool pseudo_classes_match_identically = true;
+        for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
+            auto pseudo_class = static_cast<PseudoClass>(i);
+            if (attempted_pseudo_class_matches.get(pseudo_class) && !SelectorEngine::matches_pseudo_class_identically(pseudo_class, element, *sibling)) {
+                pseudo_classes_match_identically = false;
+                break;
+            }
+        }
+        if (!pseudo_classes_match_identically)
+            continue;
+
+        return sibling;
+    }
+
+    return {};
+}
+
 static bool is_monospace(StyleValue const& value)
 {
     if (value.to_keyword() == Keyword::Monospace)
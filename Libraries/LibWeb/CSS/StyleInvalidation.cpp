@@ -15,7 +15,8 @@ RequiredInvalidationAfterStyleChange compute_property_invalidation(CSS::Property
 {
     RequiredInvalidationAfterStyleChange invalidation;
 
-    bool const property_value_changed = (old_value || new_value) && ((!old_value || !new_value) || *old_value != *new_value);
+    // NOTE: Values are frequently shared between styles (e.g. initial and inherited values), so compare pointers first.
+    bool const property_value_changed = old_value != new_value && ((!old_value || !new_value) || *old_value != *new_value);
     if (!property_value_changed)
         return invalidation;
 
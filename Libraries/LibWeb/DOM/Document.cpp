@@ -123,6 +123,7 @@
 #include <LibWeb/HTML/HashChangeEvent.h>
 #include <LibWeb/HTML/ListOfAvailableImages.h>
 #include <LibWeb/HTML/Location.h>
+#include <LibWeb/HTML/MapOfPreloadedResources.h>
 #include <LibWeb/HTML/MessageEvent.h>
 #include <LibWeb/HTML/MessagePort.h>
 #include <LibWeb/HTML/Navigable.h>
@@ -508,6 +509,7 @@ void Document::initialize(JS::Realm& realm)
     m_selection = realm.create<Selection::Selection>(realm, *this);
 
     m_list_of_available_images = realm.create<HTML::ListOfAvailableImages>();
+    m_map_of_preloaded_resources = realm.create<HTML::MapOfPreloadedResources>();
 
     page().client().page_did_create_new_document(*this);
 }
@@ -592,6 +594,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
 
     visitor.visit(m_associated_animation_timelines);
     visitor.visit(m_list_of_available_images);
+    visitor.visit(m_map_of_preloaded_resources);
 
     for (auto* form_associated_element : m_form_associated_elements_with_form_attribute)
         visitor.visit(form_associated_element->form_associated_element_to_html_element());
@@ -1363,13 +1366,16 @@ void Document::update_layout(UpdateLayoutReason reason)
         }
     }
 
+    // Renumber the layout tree densely, so nodes destroyed since the last layout don't leave holes in LayoutState.
+    m_next_layout_node_index = 0;
     m_layout_root->for_each_in_inclusive_subtree([&](auto& layout_node) {
+        layout_node.set_index_in_layout_tree({}, m_next_layout_node_index++);
         layout_node.recompute_containing_block({});
         return TraversalDecision::Continue;
     });
 
     m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
-        if (child.needs_layout_update()) {
+        if (child.needs_intrinsic_sizes_update()) {
             child.reset_cached_intrinsic_sizes();
         }
         child.clear_contained_abspos_children();
@@ -1396,7 +1402,7 @@ void Document::update_layout(UpdateLayoutReason reason)
         return TraversalDecision::Continue;
     });
 
-    Layout::LayoutState layout_state;
+    Layout::LayoutState layout_state { Layout::LayoutState::Kind::Root };
 
     {
         Layout::BlockFormattingContext root_formatting_context(layout_state, Layout::LayoutMode::Normal, *m_layout_root, nullptr);
@@ -4612,6 +4618,11 @@ HTML::ListOfAvailableImages const& Document::list_of_available_images() const
     return *m_list_of_available_images;
 }
 
+HTML::MapOfPreloadedResources& Document::map_of_preloaded_resources()
+{
+    return *m_map_of_preloaded_resources;
+}
+
 CSSPixelRect Document::viewport_rect() const
 {
     if (auto const navigable = this->navigable())
@@ -354,6 +354,8 @@ public:
     Layout::Viewport const* layout_node() const;
     Layout::Viewport* layout_node();
 
+    size_t allocate_layout_node_index(Badge<Layout::Node>) { return m_next_layout_node_index++; }
+
     Painting::ViewportPaintable const* paintable() const;
     Painting::ViewportPaintable* paintable();
 
@@ -706,6 +708,8 @@ public:
     HTML::ListOfAvailableImages& list_of_available_images();
     HTML::ListOfAvailableImages const& list_of_available_images() const;
 
+    HTML::MapOfPreloadedResources& map_of_preloaded_resources();
+
     void register_intersection_observer(Badge<IntersectionObserver::IntersectionObserver>, IntersectionObserver::IntersectionObserver&);
     void unregister_intersection_observer(Badge<IntersectionObserver::IntersectionObserver>, IntersectionObserver::IntersectionObserver&);
 
@@ -1008,6 +1012,7 @@ private:
     GC::Ptr<HTML::Window> m_window;
 
     GC::Ptr<Layout::Viewport> m_layout_root;
+    size_t m_next_layout_node_index { 0 };
 
     GC::Ptr<Node> m_hovered_node;
     GC::Ptr<Node> m_inspected_node;
@@ -1190,6 +1195,9 @@ private:
     // https://html.spec.whatwg.org/multipage/images.html#list-of-available-images
     GC::Ptr<HTML::ListOfAvailableImages> m_list_of_available_images;
 
+    // https://html.spec.whatwg.org/multipage/links.html#map-of-preloaded-resources
+    GC::Ptr<HTML::MapOfPreloadedResources> m_map_of_preloaded_resources;
+
     GC::Ptr<CSS::VisualViewport> m_visual_viewport;
 
     // NOTE: Not in the spec per se, but Document must be able to access all IntersectionObservers whose root is in the document.
@@ -679,6 +679,10 @@ static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation(C
         auto property_id = static_cast<CSS::PropertyID>(i);
 
         invalidation |= CSS::compute_property_invalidation(property_id, old_style.property(property_id), new_style.property(property_id));
+
+        // No other property can make the required invalidation any larger than this.
+        if (invalidation.is_full())
+            break;
     }
     return invalidation;
 }
@@ -40,6 +40,20 @@ void FetchParams::visit_edges(JS::Cell::Visitor& visitor)
         visitor.visit(m_task_destination.get<GC::Ref<JS::Object>>());
     if (m_preloaded_response_candidate.has<GC::Ref<Response>>())
         visitor.visit(m_preloaded_response_candidate.get<GC::Ref<Response>>());
+    visitor.visit(m_on_preloaded_response_candidate_available);
+}
+
+void FetchParams::set_preloaded_response_candidate(PreloadedResponseCandidate preloaded_response_candidate)
+{
+    m_preloaded_response_candidate = move(preloaded_response_candidate);
+
+    auto const* response = m_preloaded_response_candidate.get_pointer<GC::Ref<Response>>();
+    if (!response || !m_on_preloaded_response_candidate_available)
+        return;
+
+    auto on_preloaded_response_candidate_available = m_on_preloaded_response_candidate_available.as_nonnull();
+    m_on_preloaded_response_candidate_available = nullptr;
+    on_preloaded_response_candidate_available->function()(*response);
 }
 
 // https://fetch.spec.whatwg.org/#fetch-params-aborted
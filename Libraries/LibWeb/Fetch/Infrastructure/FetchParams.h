@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Forward.h>
+#include <LibGC/Function.h>
 #include <LibGC/Ptr.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
@@ -27,6 +28,7 @@ class WEB_API FetchParams : public JS::Cell {
 public:
     struct PreloadedResponseCandidatePendingTag { };
     using PreloadedResponseCandidate = Variant<Empty, PreloadedResponseCandidatePendingTag, GC::Ref<Response>>;
+    using OnPreloadedResponseCandidateAvailable = GC::Function<void(GC::Ref<Response>)>;
 
     [[nodiscard]] static GC::Ref<FetchParams> create(JS::VM&, GC::Ref<Request>, GC::Ref<FetchTimingInfo>);
 
@@ -46,7 +48,11 @@ public:
 
     [[nodiscard]] PreloadedResponseCandidate& preloaded_response_candidate() { return m_preloaded_response_candidate; }
     [[nodiscard]] PreloadedResponseCandidate const& preloaded_response_candidate() const { return m_preloaded_response_candidate; }
-    void set_preloaded_response_candidate(PreloadedResponseCandidate preloaded_response_candidate) { m_preloaded_response_candidate = move(preloaded_response_candidate); }
+    void set_preloaded_response_candidate(PreloadedResponseCandidate);
+
+    // Main fetch waits for a "pending" preloaded response candidate to become a response through this callback, rather
+    // than by spinning the event loop. It only has const access to the fetch params, hence the const.
+    void set_on_preloaded_response_candidate_available(GC::Ref<OnPreloadedResponseCandidateAvailable> callback) const { m_on_preloaded_response_candidate_available = callback; }
 
     [[nodiscard]] bool is_aborted() const;
     [[nodiscard]] bool is_canceled() const;
@@ -100,6 +106,8 @@ private:
     // preloaded response candidate (default null)
     //     Null, "pending", or a response.
     PreloadedResponseCandidate m_preloaded_response_candidate;
+
+    mutable GC::Ptr<OnPreloadedResponseCandidateAvailable> m_on_preloaded_response_candidate_available;
 };
 
 }
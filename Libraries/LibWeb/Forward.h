@@ -43,6 +43,7 @@ class DisplayListPlayerSkia;
 class DisplayListRecorder;
 class SVGGradientPaintStyle;
 class ScrollStateSnapshot;
+class TileRasterizer;
 using PaintStyle = RefPtr<SVGGradientPaintStyle>;
 using PaintStyleOrColor = Variant<PaintStyle, Gfx::Color>;
 using ScrollStateSnapshotByDisplayList = HashMap<NonnullRefPtr<DisplayList>, ScrollStateSnapshot>;
@@ -705,6 +706,7 @@ class ImageData;
 class ImageRequest;
 class ListOfAvailableImages;
 class Location;
+class MapOfPreloadedResources;
 class MediaError;
 class MessageChannel;
 class MessageEvent;
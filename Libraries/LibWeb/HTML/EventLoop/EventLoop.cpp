@@ -87,6 +87,8 @@ void EventLoop::spin_until(GC::Ref<GC::Function<bool()>> goal_condition)
     vm.save_execution_context_stack();
     vm.clear_execution_context_stack();
 
+    ++m_spin_nesting_level;
+
     // 5. Perform a microtask checkpoint.
     perform_a_microtask_checkpoint();
 
@@ -108,6 +110,8 @@ void EventLoop::spin_until(GC::Ref<GC::Function<bool()>> goal_condition)
         return goal_condition->function()();
     }));
 
+    --m_spin_nesting_level;
+
     vm.restore_execution_context_stack();
 
     // 7. Stop task, allowing whatever algorithm that invoked it to resume.
@@ -216,6 +220,17 @@ void EventLoop::process()
         for (auto& win : same_loop_windows()) {
             win->start_an_idle_period();
         }
+
+        // OPTIMIZATION: No task is runnable, so this is a good moment to collect garbage. Doing it here means fewer
+        //               collections get triggered from inside tasks, where they delay script and input handling.
+        //               While the event loop is being spun, the algorithm that spun it is suspended in the middle of a
+        //               task, with all of its frames still on the stack. Collecting then is no cheaper than collecting on
+        //               allocation, so we leave it to the outermost event loop.
+        //               The collection is skipped if it isn't expected to finish before the idle period's deadline.
+        if (m_spin_nesting_level == 0) {
+            auto time_until_deadline = compute_deadline() - HighResolutionTime::unsafe_shared_current_time();
+            heap().collect_garbage_if_idle_threshold_reached(AK::Duration::from_milliseconds(static_cast<i64>(time_until_deadline)));
+        }
     }
 
     // If there are eligible tasks in the queue, schedule a new round of processing. :^)
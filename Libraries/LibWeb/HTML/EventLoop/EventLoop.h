@@ -136,6 +136,9 @@ private:
 
     bool m_skip_event_loop_processing_steps { false };
 
+    // How many times spin_until() is currently on the stack.
+    size_t m_spin_nesting_level { 0 };
+
     bool m_running_rendering_task { false };
 
     GC::Ptr<GC::Function<void()>> m_rendering_task_function;
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/HTML/MapOfPreloadedResources.h>
+#include <LibWeb/SRI/SRI.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(PreloadEntry);
+GC_DEFINE_ALLOCATOR(MapOfPreloadedResources);
+
+PreloadEntry::PreloadEntry(String integrity_metadata)
+    : m_integrity_metadata(move(integrity_metadata))
+{
+}
+
+void PreloadEntry::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_response);
+    visitor.visit(m_on_response_available);
+}
+
+void PreloadEntry::set_response(GC::Ref<Fetch::Infrastructure::Response> response)
+{
+    // If the entry has already been consumed, the consumer is waiting for this response.
+    if (auto on_response_available = m_on_response_available) {
+        m_on_response_available = nullptr;
+        on_response_available->function()(response);
+        return;
+    }
+
+    m_response = response;
+}
+
+MapOfPreloadedResources::MapOfPreloadedResources() = default;
+MapOfPreloadedResources::~MapOfPreloadedResources() = default;
+
+MapOfPreloadedResources::Key MapOfPreloadedResources::Key::for_request(Fetch::Infrastructure::Request const& request)
+{
+    return {
+        .url = request.url(),
+        .destination = request.destination(),
+        .mode = request.mode(),
+        .credentials_mode = request.credentials_mode(),
+    };
+}
+
+bool MapOfPreloadedResources::Key::operator==(Key const& other) const
+{
+    return url == other.url
+        && destination == other.destination
+        && mode == other.mode
+        && credentials_mode == other.credentials_mode;
+}
+
+u32 MapOfPreloadedResources::Key::hash() const
+{
+    u32 destination_hash = destination.has_value() ? static_cast<u32>(destination.value()) + 1 : 0;
+    return pair_int_hash(Traits<URL::URL>::hash(url), pair_int_hash(destination_hash, pair_int_hash(static_cast<u32>(mode), static_cast<u32>(credentials_mode))));
+}
+
+void MapOfPreloadedResources::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    for (auto& it : m_entries)
+        visitor.visit(it.value);
+}
+
+void MapOfPreloadedResources::set(Key const& key, GC::Ref<PreloadEntry> entry)
+{
+    m_entries.set(key, entry);
+}
+
+// https://html.spec.whatwg.org/multipage/links.html#consume-a-preloaded-resource
+bool MapOfPreloadedResources::consume(Key const& key, StringView integrity_metadata, GC::Ref<PreloadEntry::OnResponseAvailable> on_response_available)
+{
+    // 1. Let key be a preload key whose URL is url, destination is destination, mode is mode, and credentials mode is
+    //    credentialsMode.
+    // 2. Let preloads be window's associated Document's map of preloaded resources.
+    // 3. If key does not exist in preloads, then return false.
+    // NOTE: Entries for the same URL with a different key are left alone, as another consumer may still match them.
+    //       Whatever is never consumed is dropped by evict_unconsumed_entries() once the document has loaded.
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return false;
+
+    // 4. Let entry be preloads[key].
+    auto entry = it->value;
+
+    // 5. Let consumerIntegrityMetadata be the result of parsing integrityMetadata.
+    auto consumer_integrity_metadata = SRI::parse_metadata(integrity_metadata);
+
+    // 6. Let preloadIntegrityMetadata be the result of parsing entry's integrity metadata.
+    // 7. If none of the following conditions apply:
+    //    - consumerIntegrityMetadata is no metadata;
+    //    - consumerIntegrityMetadata is equal to preloadIntegrityMetadata;
+    //    then return false.
+    // NOTE: Integrity metadata that parses to the same result is compared by its serialization here.
+    // AD-HOC: The entry is evicted, since its consumer is now going to fetch the resource itself.
+    if (consumer_integrity_metadata.is_error()
+        || (!consumer_integrity_metadata.value().is_empty() && integrity_metadata != entry->integrity_metadata())) {
+        m_entries.remove(it);
+        return false;
+    }
+
+    // 8. Remove preloads[key].
+    m_entries.remove(it);
+
+    // 9. If entry's response is null, then set entry's on response available to onResponseAvailable.
+    if (!entry->response())
+        entry->set_on_response_available(on_response_available);
+    // 10. Otherwise, call onResponseAvailable with entry's response.
+    else
+        on_response_available->function()(*entry->response());
+
+    // 11. Return true.
+    return true;
+}
+
+void MapOfPreloadedResources::evict_unconsumed_entries()
+{
+    // NOTE: Entries whose fetch is still in flight are dropped along with the rest; the fetch then finishes into nothing.
+    m_entries.clear();
+}
+
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <LibGC/Function.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/links.html#preload-entry
+class PreloadEntry final : public JS::Cell {
+    GC_CELL(PreloadEntry, JS::Cell);
+    GC_DECLARE_ALLOCATOR(PreloadEntry);
+
+public:
+    using OnResponseAvailable = GC::Function<void(GC::Ref<Fetch::Infrastructure::Response>)>;
+
+    String const& integrity_metadata() const { return m_integrity_metadata; }
+
+    GC::Ptr<Fetch::Infrastructure::Response> response() const { return m_response; }
+
+    // Sets the entry's response, or hands it straight to the consumer if one is already waiting for it.
+    void set_response(GC::Ref<Fetch::Infrastructure::Response>);
+
+    void set_on_response_available(GC::Ref<OnResponseAvailable> on_response_available) { m_on_response_available = on_response_available; }
+
+private:
+    explicit PreloadEntry(String integrity_metadata);
+
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    // https://html.spec.whatwg.org/multipage/links.html#preload-integrity-metadata
+    String m_integrity_metadata;
+
+    // https://html.spec.whatwg.org/multipage/links.html#preload-response
+    GC::Ptr<Fetch::Infrastructure::Response> m_response;
+
+    // https://html.spec.whatwg.org/multipage/links.html#preload-on-response-available
+    GC::Ptr<OnResponseAvailable> m_on_response_available;
+};
+
+// https://html.spec.whatwg.org/multipage/links.html#map-of-preloaded-resources
+class MapOfPreloadedResources final : public JS::Cell {
+    GC_CELL(MapOfPreloadedResources, JS::Cell);
+    GC_DECLARE_ALLOCATOR(MapOfPreloadedResources);
+
+public:
+    // https://html.spec.whatwg.org/multipage/links.html#preload-key
+    struct Key {
+        URL::URL url;
+        Optional<Fetch::Infrastructure::Request::Destination> destination;
+        Fetch::Infrastructure::Request::Mode mode { Fetch::Infrastructure::Request::Mode::NoCORS };
+        Fetch::Infrastructure::Request::CredentialsMode credentials_mode { Fetch::Infrastructure::Request::CredentialsMode::SameOrigin };
+
+        static Key for_request(Fetch::Infrastructure::Request const&);
+
+        [[nodiscard]] bool operator==(Key const& other) const;
+        [[nodiscard]] u32 hash() const;
+    };
+
+    MapOfPreloadedResources();
+    virtual ~MapOfPreloadedResources() override;
+
+    [[nodiscard]] bool contains(Key const& key) const { return m_entries.contains(key); }
+    void set(Key const&, GC::Ref<PreloadEntry>);
+
+    // https://html.spec.whatwg.org/multipage/links.html#consume-a-preloaded-resource
+    bool consume(Key const&, StringView integrity_metadata, GC::Ref<PreloadEntry::OnResponseAvailable>);
+
+    // Drops the entries that nobody has consumed. Once the document has loaded, the elements the speculative parser
+    // fetched resources for have all started their own fetches, so whatever is left is never going to be used.
+    void evict_unconsumed_entries();
+
+private:
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    HashMap<Key, GC::Ref<PreloadEntry>> m_entries;
+};
+
+}
+
+namespace AK {
+
+template<>
+struct Traits<Web::HTML::MapOfPreloadedResources::Key> : public DefaultTraits<Web::HTML::MapOfPreloadedResources::Key> {
+    static unsigned hash(Web::HTML::MapOfPreloadedResources::Key const& key)
+    {
+        return key.hash();
+    }
+    static bool equals(Web::HTML::MapOfPreloadedResources::Key const& a, Web::HTML::MapOfPreloadedResources::Key const& b)
+    {
+        return a == b;
+    }
+};
+
+}
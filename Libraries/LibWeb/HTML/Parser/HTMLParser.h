@@ -10,6 +10,7 @@
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/Export.h>
+#include <LibWeb/HTML/Parser/HTMLPreloadScanner.h>
 #include <LibWeb/HTML/Parser/HTMLTokenizer.h>
 #include <LibWeb/HTML/Parser/ListOfActiveFormattingElements.h>
 #include <LibWeb/HTML/Parser/StackOfOpenElements.h>
@@ -198,6 +199,7 @@ private:
     ListOfActiveFormattingElements m_list_of_active_formatting_elements;
 
     HTMLTokenizer m_tokenizer;
+    HTMLPreloadScanner m_preload_scanner;
 
     bool m_next_line_feed_can_be_ignored { false };
 
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/Fetch/Infrastructure/URL.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/CORSSettingAttribute.h>
+#include <LibWeb/HTML/MapOfPreloadedResources.h>
+#include <LibWeb/HTML/Parser/HTMLPreloadScanner.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+#include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/SourceSet.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/MimeSniff/MimeType.h>
+
+namespace Web::HTML {
+
+HTMLPreloadScanner::HTMLPreloadScanner()
+{
+    // Our tokenizer stops at the insertion point rather than at the end of its input, so that it can pick up where it
+    // left off (even in the middle of a token) once it is fed more input.
+    m_tokenizer.update_insertion_point();
+}
+
+void HTMLPreloadScanner::scan(DOM::Document& document, HTMLTokenizer const& parser_tokenizer, bool scripting_enabled)
+{
+    auto input = parser_tokenizer.decoded_input();
+    auto scan_start = parser_tokenizer.current_offset();
+
+    // document.write() only ever inserts input at the parser's insertion point, which never lies past the input we have
+    // already fed to our tokenizer, so it just shifts the end of that input along. The parser is always behind us, but
+    // if it ever got ahead, skip to where it is.
+    if (m_fed_input_end.has_value())
+        scan_start = max(scan_start, *m_fed_input_end + (parser_tokenizer.code_points_inserted() - m_code_points_inserted_when_fed));
+
+    m_fed_input_end = input.size();
+    m_code_points_inserted_when_fed = parser_tokenizer.code_points_inserted();
+
+    if (scan_start >= input.size())
+        return;
+
+    auto new_input = input.slice(scan_start);
+    dbgln_if(HTML_PARSER_DEBUG, "HTMLPreloadScanner: Scanning {} code points ahead of the parser", new_input.size());
+    m_tokenizer.append_to_input_stream(new_input);
+
+    for (;;) {
+        auto token = m_tokenizer.next_token(HTMLTokenizer::StopAtInsertionPoint::Yes);
+        if (!token.has_value() || token->is_end_of_file())
+            break;
+
+        if (token->is_end_tag()) {
+            if (token->tag_name() == TagNames::template_ && m_state.template_depth > 0)
+                --m_state.template_depth;
+            else if (token->tag_name() == TagNames::picture && m_state.picture_depth > 0)
+                --m_state.picture_depth;
+            continue;
+        }
+
+        if (!token->is_start_tag())
+            continue;
+
+        auto const& tag_name = token->tag_name();
+
+        // Nothing inside a template is fetched until the template's contents are used.
+        if (tag_name == TagNames::template_) {
+            ++m_state.template_depth;
+            continue;
+        }
+        if (tag_name == TagNames::picture)
+            ++m_state.picture_depth;
+
+        if (m_state.template_depth == 0)
+            process_start_tag(document, *token, m_state);
+
+        // Switch the tokenizer to the state the tree builder would put it in, so that the contents of these elements
+        // are not mistaken for markup.
+        if (tag_name == TagNames::script)
+            m_tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+        else if (tag_name.is_one_of(TagNames::title, TagNames::textarea))
+            m_tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+        else if (tag_name.is_one_of(TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes))
+            m_tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+        else if (tag_name == TagNames::noscript && scripting_enabled)
+            m_tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+        else if (tag_name == TagNames::plaintext)
+            m_tokenizer.switch_to(HTMLTokenizer::State::PLAINTEXT);
+    }
+}
+
+Optional<URL::URL> HTMLPreloadScanner::parse_url(DOM::Document& document, ScanState const& state, StringView url) const
+{
+    // A base element further ahead in the input has not been inserted yet, so its URL has to be applied here.
+    if (state.base_url.has_value())
+        return DOMURL::parse(url, *state.base_url, document.encoding_or_default());
+    return document.encoding_parse_url(url);
+}
+
+void HTMLPreloadScanner::process_start_tag(DOM::Document& document, HTMLToken const& token, ScanState& state)
+{
+    auto& vm = document.vm();
+    auto const& tag_name = token.tag_name();
+
+    if (tag_name == TagNames::base) {
+        // Only the first base element with an href attribute affects the document base URL.
+        if (state.base_url.has_value() || document.first_base_element_with_href_in_tree_order())
+            return;
+        if (auto href = token.attribute(AttributeNames::href); href.has_value())
+            state.base_url = DOMURL::parse(*href, document.fallback_base_url(), document.encoding_or_default()).value_or(document.fallback_base_url());
+        return;
+    }
+
+    if (tag_name == TagNames::script) {
+        auto src = token.attribute(AttributeNames::src);
+        if (!src.has_value() || src->is_empty())
+            return;
+
+        // Work out the script's type the same way as HTMLScriptElement::prepare_script().
+        String script_block_type;
+        auto maybe_type_attribute = token.attribute(AttributeNames::type);
+        auto maybe_language_attribute = token.attribute(AttributeNames::language);
+        if ((maybe_type_attribute.has_value() && maybe_type_attribute->is_empty())
+            || (!maybe_type_attribute.has_value() && (!maybe_language_attribute.has_value() || maybe_language_attribute->is_empty())))
+            script_block_type = "text/javascript"_string;
+        else if (maybe_type_attribute.has_value())
+            script_block_type = MUST(maybe_type_attribute->trim(Infra::ASCII_WHITESPACE));
+        else
+            script_block_type = MUST(String::formatted("text/{}", maybe_language_attribute.value()));
+
+        auto url = parse_url(document, state, *src);
+        if (!url.has_value())
+            return;
+
+        auto cors_setting = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+        GC::Ptr<Fetch::Infrastructure::Request> request;
+
+        if (MimeSniff::is_javascript_mime_type_essence_match(script_block_type)) {
+            // Classic scripts with a nomodule attribute are never run.
+            if (token.has_attribute(AttributeNames::nomodule))
+                return;
+
+            // Same as fetch_classic_script().
+            request = create_potential_CORS_request(vm, *url, Fetch::Infrastructure::Request::Destination::Script, cors_setting);
+        } else if (script_block_type.equals_ignoring_ascii_case("module"sv)) {
+            // Same as fetch_single_module_script() for a top-level JavaScript module script.
+            request = Fetch::Infrastructure::Request::create(vm);
+            request->set_url(*url);
+            request->set_mode(Fetch::Infrastructure::Request::Mode::CORS);
+            request->set_destination(Fetch::Infrastructure::Request::Destination::Script);
+            request->set_credentials_mode(cors_setting == CORSSettingAttribute::UseCredentials
+                    ? Fetch::Infrastructure::Request::CredentialsMode::Include
+                    : Fetch::Infrastructure::Request::CredentialsMode::SameOrigin);
+        } else {
+            return;
+        }
+
+        if (auto integrity = token.attribute(AttributeNames::integrity); integrity.has_value())
+            request->set_integrity_metadata(*integrity);
+        request->set_initiator_type(Fetch::Infrastructure::Request::InitiatorType::Script);
+        speculative_fetch(document, *request);
+        return;
+    }
+
+    if (tag_name == TagNames::link) {
+        auto href = token.attribute(AttributeNames::href);
+        auto rel = token.attribute(AttributeNames::rel);
+        if (!href.has_value() || href->is_empty() || !rel.has_value())
+            return;
+
+        bool is_stylesheet = false;
+        bool is_preload = false;
+        for (auto part : rel->bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace)) {
+            if (part.equals_ignoring_ascii_case("stylesheet"sv))
+                is_stylesheet = true;
+            else if (part.equals_ignoring_ascii_case("preload"sv))
+                is_preload = true;
+        }
+
+        Optional<Fetch::Infrastructure::Request::Destination> destination;
+        if (is_stylesheet) {
+            // Alternate style sheets are not fetched until they are enabled.
+            if (rel->contains("alternate"sv, CaseSensitivity::CaseInsensitive))
+                return;
+            destination = Fetch::Infrastructure::Request::Destination::Style;
+        } else if (is_preload) {
+            // Only the destinations whose consumers fetch through the map of preloaded resources are worth preloading.
+            auto as = token.attribute(AttributeNames::as).value_or({});
+            if (as.equals_ignoring_ascii_case("script"sv))
+                destination = Fetch::Infrastructure::Request::Destination::Script;
+            else if (as.equals_ignoring_ascii_case("style"sv))
+                destination = Fetch::Infrastructure::Request::Destination::Style;
+            else if (as.equals_ignoring_ascii_case("image"sv))
+                destination = Fetch::Infrastructure::Request::Destination::Image;
+            else
+                return;
+        } else {
+            return;
+        }
+
+        auto url = parse_url(document, state, *href);
+        if (!url.has_value())
+            return;
+
+        // Same as HTMLLinkElement::create_link_request().
+        auto request = create_potential_CORS_request(vm, *url, destination, cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin)));
+        if (auto integrity = token.attribute(AttributeNames::integrity); integrity.has_value())
+            request->set_integrity_metadata(*integrity);
+        request->set_initiator_type(is_stylesheet ? Fetch::Infrastructure::Request::InitiatorType::CSS : Fetch::Infrastructure::Request::InitiatorType::Link);
+        speculative_fetch(document, request);
+        return;
+    }
+
+    if (tag_name == TagNames::img) {
+        // Which source a picture element selects depends on its source elements' media queries, and lazy images are
+        // only fetched once they come near the viewport.
+        if (state.picture_depth > 0)
+            return;
+        if (auto loading = token.attribute(AttributeNames::loading); loading.has_value() && loading->equals_ignoring_ascii_case("lazy"sv))
+            return;
+
+        auto src = token.attribute(AttributeNames::src).value_or({});
+        auto srcset = token.attribute(AttributeNames::srcset).value_or({});
+        String selected_source = src;
+
+        if (!srcset.is_empty()) {
+            // Create the source set the same way as SourceSet::create(), but without an element to resolve the sizes
+            // attribute against. Width descriptors depend on it, so give up on those.
+            auto source_set = parse_a_srcset_attribute(srcset);
+            bool contains_image_source_with_pixel_density_descriptor_value_of_1 = false;
+            for (auto& source : source_set.m_sources) {
+                if (source.descriptor.has<ImageSource::WidthDescriptorValue>())
+                    return;
+                if (source.descriptor.has<Empty>())
+                    source.descriptor = ImageSource::PixelDensityDescriptorValue { .value = 1.0 };
+                if (source.descriptor.get<ImageSource::PixelDensityDescriptorValue>().value == 1.0)
+                    contains_image_source_with_pixel_density_descriptor_value_of_1 = true;
+            }
+            if (!src.is_empty() && !contains_image_source_with_pixel_density_descriptor_value_of_1)
+                source_set.m_sources.append({ .url = src, .descriptor = ImageSource::PixelDensityDescriptorValue { .value = 1.0 } });
+            if (source_set.is_empty())
+                return;
+            selected_source = source_set.select_an_image_source().source.url;
+        }
+
+        if (selected_source.is_empty())
+            return;
+
+        auto url = parse_url(document, state, selected_source);
+        if (!url.has_value())
+            return;
+
+        // Same as HTMLImageElement::update_the_image_data().
+        auto request = create_potential_CORS_request(vm, *url, Fetch::Infrastructure::Request::Destination::Image, cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin)));
+        if (!srcset.is_empty())
+            request->set_initiator(Fetch::Infrastructure::Request::Initiator::ImageSet);
+        speculative_fetch(document, request);
+        return;
+    }
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-fetch
+void HTMLPreloadScanner::speculative_fetch(DOM::Document& document, GC::Ref<Fetch::Infrastructure::Request> request)
+{
+    // Only HTTP(S) responses are ever picked up from the map of preloaded resources.
+    if (!Fetch::Infrastructure::is_http_or_https_scheme(request->url().scheme()))
+        return;
+
+    // The user agent should not perform the same speculative fetch more than once.
+    if (m_speculative_fetch_urls.set(request->url()) != HashSetResult::InsertedNewEntry)
+        return;
+
+    auto& preloads = document.map_of_preloaded_resources();
+    auto key = MapOfPreloadedResources::Key::for_request(*request);
+    if (preloads.contains(key))
+        return;
+
+    dbgln_if(HTML_PARSER_DEBUG, "HTMLPreloadScanner: Speculatively fetching {}", request->url());
+
+    auto& realm = document.realm();
+    request->set_client(&document.relevant_settings_object());
+
+    auto entry = realm.create<PreloadEntry>(request->integrity_metadata());
+
+    Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
+    fetch_algorithms_input.process_response_consume_body = [&realm, entry](GC::Ref<Fetch::Infrastructure::Response> response, Fetch::Infrastructure::FetchAlgorithms::BodyBytes body_bytes) {
+        // Reading the body used it up, so give the response a fresh one for whoever consumes it.
+        if (auto const* bytes = body_bytes.get_pointer<ByteBuffer>(); bytes && !response->is_network_error())
+            response->unsafe_response()->set_body(Fetch::Infrastructure::byte_sequence_as_body(realm, *bytes));
+
+        entry->set_response(response);
+    };
+
+    auto fetch_controller = Fetch::Fetching::fetch(realm, request, Fetch::Infrastructure::FetchAlgorithms::create(realm.vm(), move(fetch_algorithms_input)));
+    if (fetch_controller.is_error())
+        return;
+
+    // NOTE: The entry is only added once the fetch has been started, so that the fetch does not consume it itself.
+    preloads.set(key, entry);
+}
+
+}
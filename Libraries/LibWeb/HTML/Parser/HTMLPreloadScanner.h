@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashTable.h>
+#include <LibGC/Ptr.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+
+namespace Web::HTML {
+
+// A speculative HTML parser that only looks for subresources to fetch.
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-html-parsing
+//
+// While the parser is blocked on a parsing-blocking script, the rest of the input stream is run through a separate
+// tokenizer, and the scripts, style sheets and images it refers to are fetched right away. The responses end up in
+// the document's map of preloaded resources, where the fetches made once the parser gets to those elements pick them
+// up instead of going to the network again.
+//
+// The tokenizer is kept around between scans, and is only ever fed the input it hasn't seen yet.
+class HTMLPreloadScanner {
+public:
+    HTMLPreloadScanner();
+
+    void scan(DOM::Document&, HTMLTokenizer const&, bool scripting_enabled);
+
+private:
+    struct ScanState {
+        Optional<URL::URL> base_url;
+        size_t template_depth { 0 };
+        size_t picture_depth { 0 };
+    };
+
+    void process_start_tag(DOM::Document&, HTMLToken const&, ScanState&);
+    Optional<URL::URL> parse_url(DOM::Document&, ScanState const&, StringView) const;
+
+    // https://html.spec.whatwg.org/multipage/parsing.html#speculative-fetch
+    void speculative_fetch(DOM::Document&, GC::Ref<Fetch::Infrastructure::Request>);
+
+    // https://html.spec.whatwg.org/multipage/parsing.html#list-of-speculative-fetch-urls
+    HashTable<URL::URL> m_speculative_fetch_urls;
+
+    HTMLTokenizer m_tokenizer;
+    ScanState m_state;
+
+    // Where the input we have fed to our tokenizer ends in the parser's input stream, and how many code points had been
+    // inserted into that stream by document.write() at the time.
+    Optional<size_t> m_fed_input_end;
+    size_t m_code_points_inserted_when_fed { 0 };
+};
+
+}
@@ -8,6 +8,8 @@
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/GenericShorthands.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/SourceLocation.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/HTML/Parser/Entities.h>
@@ -237,6 +239,68 @@ void HTMLTokenizer::skip(size_t count)
     }
 }
 
+// Returns the offset of the first code point that is one of the given ones, or the size of the input if there is none.
+static size_t find_first_of(ReadonlySpan<u32> input, size_t start_offset, u32 a, u32 b, u32 c, u32 d)
+{
+    using AK::SIMD::u32x4;
+    static constexpr size_t lanes = AK::SIMD::vector_length<u32x4>;
+
+    size_t offset = start_offset;
+    for (; offset + lanes <= input.size(); offset += lanes) {
+        auto chunk = AK::SIMD::load_unaligned<u32x4>(input.offset_pointer(offset));
+        auto matches = (chunk == a) | (chunk == b) | (chunk == c) | (chunk == d);
+        auto words = bit_cast<AK::SIMD::u64x2>(matches);
+        if ((words[0] | words[1]) == 0)
+            continue;
+        for (size_t i = 0; i < lanes; ++i) {
+            if (matches[i])
+                return offset + i;
+        }
+    }
+
+    for (; offset < input.size(); ++offset) {
+        if (first_is_one_of(input[offset], a, b, c, d))
+            return offset;
+    }
+    return input.size();
+}
+
+// Appends every code point up to the next one that the quoted attribute value states handle specially to the current
+// builder, without going through the state machine one code point at a time.
+void HTMLTokenizer::consume_quoted_attribute_value_run(u32 quote, StopAtInsertionPoint stop_at_insertion_point)
+{
+    auto end = m_decoded_input.size();
+    if (stop_at_insertion_point == StopAtInsertionPoint::Yes && m_insertion_point.defined)
+        end = min(end, static_cast<size_t>(max<ssize_t>(m_insertion_point.position, m_current_offset)));
+
+    // NOTE: We also stop at carriage returns, so next_code_point() can normalize newlines.
+    auto input = m_decoded_input.span().slice(0, end);
+    auto run_start = static_cast<size_t>(m_current_offset);
+    auto run_end = find_first_of(input, run_start, quote, '&', 0, '\r');
+    if (run_end == run_start)
+        return;
+
+    auto run = input.slice(run_start, run_end - run_start);
+    for (auto code_point : run)
+        m_current_builder.append_code_point(code_point);
+
+    if (!m_source_positions.is_empty()) {
+        auto position = m_source_positions.last();
+        for (auto code_point : run) {
+            if (code_point == '\n') {
+                position.column = 0;
+                position.line++;
+            } else {
+                position.column++;
+            }
+        }
+        m_source_positions.append(position);
+    }
+
+    m_prev_offset = run_end - 1;
+    m_current_offset = run_end;
+}
+
 Optional<u32> HTMLTokenizer::peek_code_point(ssize_t offset, StopAtInsertionPoint stop_at_insertion_point) const
 {
     auto it = m_current_offset + offset;
@@ -1315,6 +1379,7 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+                    consume_quoted_attribute_value_run('"', stop_at_insertion_point);
                     continue;
                 }
             }
@@ -1347,6 +1412,7 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+                    consume_quoted_attribute_value_run('\'', stop_at_insertion_point);
                     continue;
                 }
             }
@@ -2915,6 +2981,15 @@ void HTMLTokenizer::insert_input_at_insertion_point(StringView input)
     m_decoded_input = move(new_decoded_input);
 
     m_insertion_point.position += code_points_inserted;
+    m_code_points_inserted += code_points_inserted;
+}
+
+void HTMLTokenizer::append_to_input_stream(ReadonlySpan<u32> code_points)
+{
+    auto insertion_point_is_at_end = m_insertion_point.defined && m_insertion_point.position == static_cast<ssize_t>(m_decoded_input.size());
+    m_decoded_input.append(code_points.data(), code_points.size());
+    if (insertion_point_is_at_end)
+        m_insertion_point.position = m_decoded_input.size();
 }
 
 void HTMLTokenizer::insert_eof()
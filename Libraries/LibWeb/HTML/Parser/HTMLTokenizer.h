@@ -131,6 +131,16 @@ public:
 
     auto const& source() const { return m_source; }
 
+    ReadonlySpan<u32> decoded_input() const { return m_decoded_input.span(); }
+    size_t current_offset() const { return m_current_offset; }
+
+    // The number of code points that have been inserted at the insertion point over the lifetime of this tokenizer.
+    size_t code_points_inserted() const { return m_code_points_inserted; }
+
+    // Appends already decoded code points to the end of the input stream. An insertion point at the end of the input
+    // moves along with it, so a tokenizer that stops at the insertion point can be fed its input piece by piece.
+    void append_to_input_stream(ReadonlySpan<u32>);
+
     void insert_input_at_insertion_point(StringView input);
     void insert_eof();
     bool is_eof_inserted();
@@ -155,6 +165,7 @@ public:
 private:
     void skip(size_t count);
     Optional<u32> next_code_point(StopAtInsertionPoint);
+    void consume_quoted_attribute_value_run(u32 quote, StopAtInsertionPoint);
     Optional<u32> peek_code_point(ssize_t offset, StopAtInsertionPoint) const;
 
     enum class ConsumeNextResult {
@@ -209,6 +220,8 @@ private:
     ssize_t m_current_offset { 0 };
     ssize_t m_prev_offset { 0 };
 
+    size_t m_code_points_inserted { 0 };
+
     HTMLToken m_current_token;
     StringBuilder m_current_builder;
 
@@ -9,6 +9,7 @@
 #include <LibWeb/HTML/RenderingThread.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/TileRasterizer.h>
 
 namespace Web::HTML {
 
@@ -38,6 +39,11 @@ void RenderingThread::start(DisplayListPlayerType display_list_player_type)
 {
     m_display_list_player_type = display_list_player_type;
     VERIFY(m_skia_player);
+
+    // NOTE: A GPU context can only be used from one thread at a time, so only the CPU player rasterizes in parallel.
+    if (m_display_list_player_type == DisplayListPlayerType::SkiaCPU)
+        m_tile_rasterizer = make<Painting::TileRasterizer>();
+
     m_thread = Threading::Thread::construct([this] {
         rendering_thread_loop();
         return static_cast<intptr_t>(0);
@@ -68,7 +74,10 @@ void RenderingThread::rendering_thread_loop()
             break;
         }
 
-        m_skia_player->execute(*task->display_list, move(task->scroll_state_snapshot_by_display_list), task->painting_surface);
+        if (m_tile_rasterizer && Painting::TileRasterizer::can_rasterize_in_tiles(*task->display_list, task->painting_surface->size()))
+            m_tile_rasterizer->rasterize(*task->display_list, task->scroll_state_snapshot_by_display_list, *task->painting_surface);
+        else
+            m_skia_player->execute(*task->display_list, move(task->scroll_state_snapshot_by_display_list), task->painting_surface);
         if (m_exit)
             break;
         task->callback();
@@ -36,6 +36,7 @@ private:
     DisplayListPlayerType m_display_list_player_type;
 
     OwnPtr<Painting::DisplayListPlayerSkia> m_skia_player;
+    OwnPtr<Painting::TileRasterizer> m_tile_rasterizer;
 
     RefPtr<Threading::Thread> m_thread;
     Atomic<bool> m_exit { false };
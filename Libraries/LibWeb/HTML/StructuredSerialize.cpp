@@ -9,6 +9,7 @@
 
 #include <AK/StdLibExtras.h>
 #include <AK/String.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibIPC/File.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
@@ -998,6 +999,41 @@ private:
     GC::RootVector<JS::Value> m_memory;
 };
 
+// Transferred ArrayBuffers are often sent to another process, e.g. when they are posted to a worker. Large ones are moved
+// into shared memory, so that only a file descriptor has to be sent over IPC instead of all of their bytes.
+static constexpr size_t minimum_array_buffer_size_for_shared_memory_transfer = 64 * KiB;
+
+static WebIDL::ExceptionOr<void> encode_transferred_array_buffer_data(JS::VM& vm, TransferDataEncoder& data_holder, ByteBuffer const& buffer)
+{
+    if (buffer.size() < minimum_array_buffer_size_for_shared_memory_transfer) {
+        data_holder.encode(false);
+        data_holder.encode(buffer);
+        return {};
+    }
+
+    auto shared_buffer = Core::AnonymousBuffer::create_with_size(buffer.size());
+    if (shared_buffer.is_error())
+        return WebIDL::DataCloneError::create(*vm.current_realm(), "Unable to allocate memory for transferred buffer"_utf16);
+    buffer.span().copy_to({ shared_buffer.value().data<u8>(), buffer.size() });
+
+    data_holder.encode(true);
+    data_holder.encode(shared_buffer.value());
+    return {};
+}
+
+static WebIDL::ExceptionOr<ByteBuffer> decode_transferred_array_buffer_data(JS::Realm& realm, TransferDataDecoder& decoder)
+{
+    auto is_in_shared_memory = decoder.decode<bool>();
+    if (!is_in_shared_memory)
+        return decoder.decode_buffer(realm);
+
+    auto shared_buffer = TRY(decoder.decode_anonymous_buffer(realm));
+    auto buffer = ByteBuffer::copy(shared_buffer.data<u8>(), shared_buffer.size());
+    if (buffer.is_error())
+        return WebIDL::DataCloneError::create(realm, "Unable to allocate memory for transferred buffer"_utf16);
+    return buffer.release_value();
+}
+
 // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializewithtransfer
 WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer(JS::VM& vm, JS::Value value, Vector<GC::Root<JS::Object>> const& transfer_list)
 {
@@ -1062,7 +1098,7 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
 
                 // 2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
                 // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
-                data_holder.encode(array_buffer->buffer());
+                TRY(encode_transferred_array_buffer_data(vm, data_holder, array_buffer->buffer()));
 
                 // 4. Set dataHolder.[[ArrayBufferMaxByteLength]] to transferable.[[ArrayBufferMaxByteLength]].
                 data_holder.encode(array_buffer->max_byte_length());
@@ -1074,7 +1110,7 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
 
                 // 2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
                 // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
-                data_holder.encode(array_buffer->buffer());
+                TRY(encode_transferred_array_buffer_data(vm, data_holder, array_buffer->buffer()));
             }
 
             // 3. Perform ? DetachArrayBuffer(transferable).
@@ -1219,7 +1255,7 @@ WebIDL::ExceptionOr<JS::Value> structured_deserialize_with_transfer_internal(Tra
     //       [[ArrayBufferData]] is instead just getting transferred into the new ArrayBuffer. This could be true, for example,
     //       when both the source and target realms are in the same process.
     if (type == TransferType::ArrayBuffer) {
-        auto buffer = TRY(decoder.decode_buffer(target_realm));
+        auto buffer = TRY(decode_transferred_array_buffer_data(target_realm, decoder));
         value = JS::ArrayBuffer::create(target_realm, move(buffer));
     }
 
@@ -1229,7 +1265,7 @@ WebIDL::ExceptionOr<JS::Value> structured_deserialize_with_transfer_internal(Tra
     //     [[ArrayBufferMaxByteLength]] internal slot value is transferDataHolder.[[ArrayBufferMaxByteLength]].
     // NOTE: For the same reason as the previous step, this step is also unlikely to throw an exception.
     else if (type == TransferType::ResizableArrayBuffer) {
-        auto buffer = TRY(decoder.decode_buffer(target_realm));
+        auto buffer = TRY(decode_transferred_array_buffer_data(target_realm, decoder));
         auto max_byte_length = decoder.decode<size_t>();
 
         auto data = JS::ArrayBuffer::create(target_realm, move(buffer));
@@ -1348,6 +1384,18 @@ WebIDL::ExceptionOr<ByteBuffer> TransferDataDecoder::decode_buffer(JS::Realm& re
     return buffer.release_value();
 }
 
+WebIDL::ExceptionOr<Core::AnonymousBuffer> TransferDataDecoder::decode_anonymous_buffer(JS::Realm& realm)
+{
+    // NOTE: The buffer's file descriptor may be missing, or mapping it may fail, if the sending process misbehaved or
+    //       we are out of address space. Neither should bring down the receiving process.
+    auto buffer = m_decoder.decode<Core::AnonymousBuffer>();
+
+    if (buffer.is_error() || !buffer.value().is_valid())
+        return WebIDL::DataCloneError::create(realm, "Unable to map transferred buffer"_utf16);
+
+    return buffer.release_value();
+}
+
 }
 
 namespace IPC {
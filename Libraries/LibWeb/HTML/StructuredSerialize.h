@@ -10,6 +10,7 @@
 
 #include <AK/MemoryStream.h>
 #include <AK/Vector.h>
+#include <LibCore/Forward.h>
 #include <LibIPC/Decoder.h>
 #include <LibIPC/Encoder.h>
 #include <LibIPC/Message.h>
@@ -52,10 +53,12 @@ public:
     T decode()
     {
         static_assert(!IsSame<T, ByteBuffer>, "Use decode_buffer to handle OOM");
+        static_assert(!IsSame<T, Core::AnonymousBuffer>, "Use decode_anonymous_buffer to handle mapping failures");
         return MUST(m_decoder.decode<T>());
     }
 
     WebIDL::ExceptionOr<ByteBuffer> decode_buffer(JS::Realm&);
+    WebIDL::ExceptionOr<Core::AnonymousBuffer> decode_anonymous_buffer(JS::Realm&);
 
 private:
     IPC::MessageBuffer m_buffer;
@@ -1566,18 +1566,20 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
     if (primary_key)
         VERIFY(source.has<GC::Ref<Index>>() && direction_is_next_or_prev);
 
+    // 5. Let range be cursor’s range.
+    // NOTE: This is done before step 4, since we need the range there.
+    auto range = cursor->range();
+
     // 4. Let records be the list of records in source.
+    // OPTIMIZATION: Every record the cursor can move to must have a key in range, so we only look at those.
     Variant<ReadonlySpan<ObjectStoreRecord>, ReadonlySpan<IndexRecord>> records = source.visit(
-        [](GC::Ref<ObjectStore> object_store) -> Variant<ReadonlySpan<ObjectStoreRecord>, ReadonlySpan<IndexRecord>> {
-            return object_store->records();
+        [&](GC::Ref<ObjectStore> object_store) -> Variant<ReadonlySpan<ObjectStoreRecord>, ReadonlySpan<IndexRecord>> {
+            return object_store->records_in_range(range);
         },
-        [](GC::Ref<Index> index) -> Variant<ReadonlySpan<ObjectStoreRecord>, ReadonlySpan<IndexRecord>> {
-            return index->records();
+        [&](GC::Ref<Index> index) -> Variant<ReadonlySpan<ObjectStoreRecord>, ReadonlySpan<IndexRecord>> {
+            return index->records_in_range(range);
         });
 
-    // 5. Let range be cursor’s range.
-    auto range = cursor->range();
-
     // 6. Let position be cursor’s position.
     auto position = cursor->position();
 
@@ -4,9 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/IndexedDB/Internal/SortedRecords.h>
 
 namespace Web::IndexedDB {
 
@@ -51,11 +51,13 @@ void Index::set_name(String name)
 
 bool Index::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(record.key, key);
-    });
+    auto index = lower_bound_for_key(records(), key);
+    return index != m_records.size() && Key::equals(m_records[index].key, key);
+}
 
-    return index != m_records.end();
+ReadonlySpan<IndexRecord> Index::records_in_range(GC::Ref<IDBKeyRange> range) const
+{
+    return IndexedDB::records_in_range(records(), *range);
 }
 
 // https://w3c.github.io/IndexedDB/#index-referenced-value
@@ -63,13 +65,7 @@ HTML::SerializationRecord Index::referenced_value(IndexRecord const& index_recor
 {
     // Records in an index are said to have a referenced value.
     // This is the value of the record in the index’s referenced object store which has a key equal to the index’s record’s value.
-    return m_object_store
-        ->records()
-        .first_matching([&](auto const& store_record) {
-            return Key::equals(store_record.key, index_record.value);
-        })
-        .value()
-        .value;
+    return m_object_store->record_with_key(index_record.value).value().value;
 }
 
 void Index::clear_records()
@@ -79,17 +75,17 @@ void Index::clear_records()
 
 Optional<IndexRecord&> Index::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto records = records_in_range(range);
+    if (records.is_empty())
+        return {};
+    return m_records[records.data() - m_records.data()];
 }
 
 GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<IndexRecord> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    for (auto const& record : records_in_range(range)) {
+        records.append(record);
 
         if (count.has_value() && records.size() >= *count)
             break;
@@ -101,9 +97,9 @@ GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange>
 GC::ConservativeVector<IndexRecord> Index::last_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<IndexRecord> records(range->heap());
-    for (auto const& record : m_records.in_reverse()) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    auto records_in_range = this->records_in_range(range);
+    for (size_t i = records_in_range.size(); i > 0; --i) {
+        records.append(records_in_range[i - 1]);
 
         if (count.has_value() && records.size() >= *count)
             break;
@@ -114,26 +110,20 @@ GC::ConservativeVector<IndexRecord> Index::last_n_in_range(GC::Ref<IDBKeyRange>
 
 u64 Index::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
-    return count;
+    return records_in_range(range).size();
 }
 
 void Index::store_a_record(IndexRecord const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in index’s list of records such that the list is sorted primarily on the records keys, and secondarily on the records values, in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        auto key_comparison = Key::compare_two_keys(a.key, b.key);
+    auto index = partition_point(records(), [&](auto const& other) {
+        auto key_comparison = Key::compare_two_keys(other.key, record.key);
         if (key_comparison != 0)
             return key_comparison < 0;
 
-        return Key::compare_two_keys(a.value, b.value) < 0;
+        return Key::compare_two_keys(other.value, record.value) <= 0;
     });
+    m_records.insert(index, record);
 }
 
 void Index::remove_records_with_value_in_range(GC::Ref<IDBKeyRange> range)
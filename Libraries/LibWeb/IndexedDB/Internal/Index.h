@@ -35,6 +35,7 @@ public:
     [[nodiscard]] KeyPath const& key_path() const { return m_key_path; }
 
     [[nodiscard]] bool has_record_with_key(GC::Ref<Key> key);
+    ReadonlySpan<IndexRecord> records_in_range(GC::Ref<IDBKeyRange> range) const;
     void clear_records();
     Optional<IndexRecord&> first_in_range(GC::Ref<IDBKeyRange> range);
     GC::ConservativeVector<IndexRecord> first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count);
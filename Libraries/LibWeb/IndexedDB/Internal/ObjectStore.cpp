@@ -4,9 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/IDBKeyRange.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/IndexedDB/Internal/SortedRecords.h>
 
 namespace Web::IndexedDB {
 
@@ -43,45 +43,50 @@ void ObjectStore::visit_edges(Visitor& visitor)
 
 void ObjectStore::remove_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    m_records.remove_all_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto records = records_in_range(range);
+    if (records.is_empty())
+        return;
+    m_records.remove(records.data() - m_records.data(), records.size());
 }
 
 bool ObjectStore::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(key, record.key);
-    });
+    return record_with_key(key).has_value();
+}
 
-    return index != m_records.end();
+Optional<ObjectStoreRecord const&> ObjectStore::record_with_key(GC::Ref<Key> key) const
+{
+    auto index = lower_bound_for_key(records(), key);
+    if (index == m_records.size() || !Key::equals(m_records[index].key, key))
+        return {};
+    return m_records[index];
 }
 
-void ObjectStore::store_a_record(ObjectStoreRecord const& record)
+ReadonlySpan<ObjectStoreRecord> ObjectStore::records_in_range(GC::Ref<IDBKeyRange> range) const
 {
-    m_records.append(record);
+    return IndexedDB::records_in_range(records(), *range);
+}
 
+void ObjectStore::store_a_record(ObjectStoreRecord const& record)
+{
     // NOTE: The record is stored in the object store’s list of records such that the list is sorted according to the key of the records in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        return Key::compare_two_keys(a.key, b.key) < 0;
+    auto index = partition_point(records(), [&](auto const& other) {
+        return Key::compare_two_keys(other.key, record.key) <= 0;
     });
+    m_records.insert(index, record);
 }
 
 u64 ObjectStore::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
-    return count;
+    return records_in_range(range).size();
 }
 
 Optional<ObjectStoreRecord&> ObjectStore::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto records = records_in_range(range);
+    if (records.is_empty())
+        return {};
+    return m_records[records.data() - m_records.data()];
 }
 
 void ObjectStore::clear_records()
@@ -92,9 +97,8 @@ void ObjectStore::clear_records()
 GC::ConservativeVector<ObjectStoreRecord> ObjectStore::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<ObjectStoreRecord> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    for (auto const& record : records_in_range(range)) {
+        records.append(record);
 
         if (count.has_value() && records.size() >= *count)
             break;
@@ -106,9 +110,9 @@ GC::ConservativeVector<ObjectStoreRecord> ObjectStore::first_n_in_range(GC::Ref<
 GC::ConservativeVector<ObjectStoreRecord> ObjectStore::last_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<ObjectStoreRecord> records(range->heap());
-    for (auto const& record : m_records.in_reverse()) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    auto records_in_range = this->records_in_range(range);
+    for (size_t i = records_in_range.size(); i > 0; --i) {
+        records.append(records_in_range[i - 1]);
 
         if (count.has_value() && records.size() >= *count)
             break;
@@ -47,6 +47,8 @@ public:
 
     void remove_records_in_range(GC::Ref<IDBKeyRange> range);
     bool has_record_with_key(GC::Ref<Key> key);
+    Optional<ObjectStoreRecord const&> record_with_key(GC::Ref<Key> key) const;
+    ReadonlySpan<ObjectStoreRecord> records_in_range(GC::Ref<IDBKeyRange> range) const;
     void store_a_record(ObjectStoreRecord const& record);
     u64 count_records_in_range(GC::Ref<IDBKeyRange> range);
     Optional<ObjectStoreRecord&> first_in_range(GC::Ref<IDBKeyRange> range);
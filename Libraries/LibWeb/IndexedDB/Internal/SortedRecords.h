@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Span.h>
+#include <LibWeb/IndexedDB/IDBKeyRange.h>
+#include <LibWeb/IndexedDB/IDBRecord.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+
+namespace Web::IndexedDB {
+
+// Object store and index records are kept sorted by key, so the records whose keys are in a given range always form a
+// contiguous run. These helpers find that run with binary searches instead of testing every record against the range.
+
+// Returns the index of the first record for which predicate returns false, assuming it returns true for some prefix of records.
+template<typename Record, typename Predicate>
+size_t partition_point(ReadonlySpan<Record> records, Predicate predicate)
+{
+    size_t low = 0;
+    size_t high = records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (predicate(records[middle]))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+template<typename Record>
+ReadonlySpan<Record> records_in_range(ReadonlySpan<Record> records, IDBKeyRange const& range)
+{
+    size_t start = 0;
+    if (auto lower = range.lower_key()) {
+        start = partition_point(records, [&](Record const& record) {
+            auto comparison = Key::compare_two_keys(record.key, *lower);
+            return comparison < 0 || (comparison == 0 && range.lower_open());
+        });
+    }
+
+    size_t end = records.size();
+    if (auto upper = range.upper_key()) {
+        end = partition_point(records, [&](Record const& record) {
+            auto comparison = Key::compare_two_keys(record.key, *upper);
+            return comparison < 0 || (comparison == 0 && !range.upper_open());
+        });
+    }
+
+    if (end <= start)
+        return {};
+    return records.slice(start, end - start);
+}
+
+template<typename Record>
+size_t lower_bound_for_key(ReadonlySpan<Record> records, GC::Ref<Key> key)
+{
+    return partition_point(records, [&](Record const& record) {
+        return Key::less_than(record.key, key);
+    });
+}
+
+}
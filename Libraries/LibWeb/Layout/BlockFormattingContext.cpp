@@ -831,8 +831,15 @@ void BlockFormattingContext::layout_block_level_box(Box const& box, BlockContain
     }
 
     if (independent_formatting_context) {
+        // NOTE: When we're only measuring the intrinsic width of our root, a box whose size is independent of its
+        //       contents contributes the same width whether or not its contents have been laid out, so we skip them.
+        auto can_skip_contents = m_layout_mode == LayoutMode::IntrinsicSizing
+            && m_state.get(root()).width_constraint != SizeConstraint::None
+            && box.is_relayout_boundary();
+
         // This box establishes a new formatting context. Pass control to it.
-        independent_formatting_context->run(box_state.available_inner_space_or_constraints_from(available_space));
+        if (!can_skip_contents)
+            independent_formatting_context->run(box_state.available_inner_space_or_constraints_from(available_space));
     } else {
         // This box participates in the current block container's flow.
         if (box.children_are_inline()) {
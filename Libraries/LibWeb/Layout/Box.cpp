@@ -78,6 +78,34 @@ Painting::PaintableBox const* Box::paintable_box() const
     return static_cast<Painting::PaintableBox const*>(Node::first_paintable());
 }
 
+bool Box::is_relayout_boundary() const
+{
+    if (is_anonymous() || is_absolutely_positioned())
+        return false;
+
+    // NOTE: Table boxes grow to fit their contents regardless of their specified size, and flex and grid containers may
+    //       size their items based on content (e.g. `flex-basis: content`), so we only consider boxes in flow layout.
+    if (display().is_table_inside() || !parent() || !parent()->is_block_container())
+        return false;
+    if (!parent()->display().is_flow_inside() && !parent()->display().is_flow_root_inside())
+        return false;
+
+    auto const& computed_values = this->computed_values();
+
+    // Contents that overflow a scroll container don't make it any larger, and its automatic minimum size is zero.
+    if (computed_values.overflow_x() == CSS::Overflow::Visible || computed_values.overflow_y() == CSS::Overflow::Visible)
+        return false;
+
+    if (!computed_values.width().is_length() || !computed_values.height().is_length())
+        return false;
+    if (!(computed_values.min_width().is_auto() || computed_values.min_width().is_length()) || !(computed_values.max_width().is_none() || computed_values.max_width().is_length()))
+        return false;
+    if (!(computed_values.min_height().is_auto() || computed_values.min_height().is_length()) || !(computed_values.max_height().is_none() || computed_values.max_height().is_length()))
+        return false;
+
+    return true;
+}
+
 Optional<CSSPixelFraction> Box::preferred_aspect_ratio() const
 {
     auto computed_aspect_ratio = computed_values().aspect_ratio();
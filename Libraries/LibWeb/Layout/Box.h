@@ -69,6 +69,10 @@ public:
     }
     void reset_cached_intrinsic_sizes() const { m_cached_intrinsic_sizes.clear(); }
 
+    // A relayout boundary is a box whose size never depends on its contents, so changes inside of it cannot affect
+    // the intrinsic sizes of its ancestors.
+    bool is_relayout_boundary() const;
+
 protected:
     Box(DOM::Document&, DOM::Node*, GC::Ref<CSS::ComputedProperties>);
     Box(DOM::Document&, DOM::Node*, NonnullOwnPtr<CSS::ComputedValues>);
@@ -18,36 +18,66 @@
 
 namespace Web::Layout {
 
+LayoutState::LayoutState(Kind kind)
+    : m_kind(kind)
+{
+}
+
 LayoutState::~LayoutState()
 {
 }
 
+void LayoutState::set_used_values_for(Node const& node, UsedValues& used_values)
+{
+    if (m_kind == Kind::Throwaway) {
+        m_used_values_by_node.set(node, &used_values);
+        return;
+    }
+
+    auto index = node.index_in_layout_tree();
+    if (index >= m_used_values_by_index.size()) {
+        // NOTE: Vector::resize() doesn't pad the capacity, so grow geometrically ourselves.
+        m_used_values_by_index.resize(max(index + 1, m_used_values_by_index.size() * 2));
+    }
+    m_used_values_by_index[index] = &used_values;
+}
+
+LayoutState::UsedValues* LayoutState::try_get(Node const& node) const
+{
+    if (m_kind == Kind::Throwaway)
+        return m_used_values_by_node.get(node).value_or(nullptr);
+
+    auto index = node.index_in_layout_tree();
+    if (index >= m_used_values_by_index.size())
+        return nullptr;
+    return m_used_values_by_index[index];
+}
+
+LayoutState::UsedValues& LayoutState::create_used_values(NodeWithStyle const& node, UsedValues const* containing_block_used_values)
+{
+    m_used_values.append(UsedValues {});
+    auto& used_values = m_used_values[m_used_values.size() - 1];
+    used_values.set_node(node, containing_block_used_values);
+    set_used_values_for(node, used_values);
+    return used_values;
+}
+
 LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyle const& node)
 {
-    if (auto* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
+    if (auto* used_values = try_get(node))
         return *used_values;
 
     auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
-
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(node, containing_block_used_values);
-    used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    return create_used_values(node, containing_block_used_values);
 }
 
 LayoutState::UsedValues const& LayoutState::get(NodeWithStyle const& node) const
 {
-    if (auto const* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
+    if (auto const* used_values = try_get(node))
         return *used_values;
 
     auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
-
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(node, containing_block_used_values);
-    const_cast<LayoutState*>(this)->used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    return const_cast<LayoutState*>(this)->create_used_values(node, containing_block_used_values);
 }
 
 // https://drafts.csswg.org/css-overflow-3/#scrollable-overflow-region
@@ -163,8 +193,7 @@ void LayoutState::resolve_relative_positions()
 {
     // This function resolves relative position offsets of fragments that belong to inline paintables.
     // It runs *after* the paint tree has been constructed, so it modifies paintable node & fragment offsets directly.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         for (auto& paintable : node.paintables()) {
@@ -256,7 +285,7 @@ void LayoutState::commit(Box& root)
                 auto& inline_node = const_cast<InlineNode&>(static_cast<InlineNode const&>(*parent));
                 auto line_paintable = inline_node.create_paintable_for_line_with_index(line_index);
                 line_paintable->add_fragment(fragment);
-                if (auto const* used_values = used_values_per_layout_node.get(inline_node).value_or(nullptr))
+                if (auto const* used_values = try_get(inline_node))
                     transfer_box_model_metrics(line_paintable->box_model(), *used_values);
                 if (!inline_node_paintables.contains(line_paintable.ptr())) {
                     inline_node_paintables.set(line_paintable.ptr());
@@ -268,8 +297,7 @@ void LayoutState::commit(Box& root)
         return false;
     };
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = used_values.node();
 
         auto paintable = node.create_paintable();
@@ -324,15 +352,14 @@ void LayoutState::commit(Box& root)
         auto line_paintable = inline_node->create_paintable_for_line_with_index(0);
         inline_node->add_paintable(line_paintable);
         inline_node_paintables.set(line_paintable.ptr());
-        if (auto const* used_values = used_values_per_layout_node.get(*inline_node).value_or(nullptr))
+        if (auto const* used_values = try_get(*inline_node))
             transfer_box_model_metrics(line_paintable->box_model(), *used_values);
     }
 
     // Resolve relative positions for regular boxes (not line box fragments):
     // NOTE: This needs to occur before fragments are transferred into the corresponding inline paintables, because
     //       after this transfer, the containing_line_box_fragment will no longer be valid.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         if (!node.is_box())
@@ -384,16 +411,16 @@ void LayoutState::commit(Box& root)
             if (paintable.line_index() != line_index)
                 return TraversalDecision::Continue;
 
-            auto used_values = used_values_per_layout_node.get(paintable.layout_node_with_style_and_box_metrics());
-            if (&paintable != paintable_with_lines && used_values.has_value())
-                size.set_width(size.width() + used_values.value()->margin_box_left() + used_values.value()->margin_box_right());
+            auto const* used_values = try_get(paintable.layout_node_with_style_and_box_metrics());
+            if (&paintable != paintable_with_lines && used_values)
+                size.set_width(size.width() + used_values->margin_box_left() + used_values->margin_box_right());
 
             auto const& fragments = paintable.fragments();
             if (!fragments.is_empty()) {
                 if (!offset.has_value() || (fragments.first().offset().x() < offset->x()))
                     offset = fragments.first().offset();
-                if (&paintable == paintable_with_lines->first_child() && used_values.has_value())
-                    offset->translate_by(-used_values.value()->margin_box_left(), 0);
+                if (&paintable == paintable_with_lines->first_child() && used_values)
+                    offset->translate_by(-used_values->margin_box_left(), 0);
             }
             for (auto const& fragment : fragments)
                 size.set_width(size.width() + fragment.width());
@@ -421,8 +448,7 @@ void LayoutState::commit(Box& root)
     }
 
     // Measure overflow in scroll containers.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto const* box = as_if<Box>(used_values.node());
         if (!box)
             continue;
@@ -436,8 +462,7 @@ void LayoutState::commit(Box& root)
             (void)paintable_box.set_scroll_offset(paintable_box.scroll_offset());
     }
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = used_values.node();
         for (auto& paintable : node.paintables()) {
             auto* paintable_box = as_if<Painting::PaintableBox>(paintable);
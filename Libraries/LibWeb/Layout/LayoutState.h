@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/SegmentedVector.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
 #include <LibWeb/Layout/Box.h>
@@ -196,6 +197,14 @@ struct LayoutState {
         Optional<StaticPositionRect> m_static_position_rect;
     };
 
+    enum class Kind {
+        // The state of a full layout pass, which ends up with used values for (nearly) every node in the layout tree.
+        Root,
+        // A short-lived state for intrinsic sizing, which only ever sees a subtree.
+        Throwaway,
+    };
+
+    explicit LayoutState(Kind = Kind::Throwaway);
     ~LayoutState();
 
     // Commits the used values produced by layout and builds a paintable tree.
@@ -204,10 +213,23 @@ struct LayoutState {
     UsedValues& get_mutable(NodeWithStyle const&);
     UsedValues const& get(NodeWithStyle const&) const;
 
-    OrderedHashMap<GC::Ref<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
+    // Returns the used values of the given node, or nullptr if they haven't been created in this state.
+    UsedValues* try_get(Node const&) const;
 
 private:
     void resolve_relative_positions();
+
+    UsedValues& create_used_values(NodeWithStyle const&, UsedValues const* containing_block_used_values);
+    void set_used_values_for(Node const&, UsedValues&);
+
+    Kind m_kind { Kind::Throwaway };
+
+    // Used values are allocated in a segmented arena in creation order, which is also the order we commit them in.
+    // The root state looks them up through the dense layout tree index of their node. Throwaway states hash the node
+    // instead, as an array spanning the indices of their subtree would make each of them O(N) in the size of the tree.
+    SegmentedVector<UsedValues, 32> m_used_values;
+    Vector<UsedValues*> m_used_values_by_index;
+    HashMap<GC::Ref<Node const>, UsedValues*> m_used_values_by_node;
 };
 
 inline CSSPixels clamp_to_max_dimension_value(CSSPixels value)
@@ -39,6 +39,7 @@ namespace Web::Layout {
 
 Node::Node(DOM::Document& document, DOM::Node* node)
     : m_dom_node(node ? *node : document)
+    , m_index_in_layout_tree(document.allocate_layout_node_index({}))
     , m_anonymous(node == nullptr)
 {
     if (node)
@@ -1379,7 +1380,9 @@ void NodeWithStyleAndBoxModelMetrics::visit_edges(Cell::Visitor& visitor)
 
 void Node::set_needs_layout_update(DOM::SetNeedsLayoutReason reason)
 {
-    if (m_needs_layout_update)
+    // NOTE: If propagation previously stopped at this node because it's a relayout boundary, a change to the node
+    //       itself still has to be propagated further up.
+    if (m_needs_layout_update && m_needs_intrinsic_sizes_update && (!parent() || parent()->m_needs_intrinsic_sizes_update))
         return;
 
     if constexpr (UPDATE_LAYOUT_DEBUG) {
@@ -1390,20 +1393,30 @@ void Node::set_needs_layout_update(DOM::SetNeedsLayoutReason reason)
     }
 
     m_needs_layout_update = true;
+    m_needs_intrinsic_sizes_update = true;
 
     // Mark any anonymous children generated by this node for layout update.
     // NOTE: if this node generated an anonymous parent, all ancestors are indiscriminately marked below.
     for_each_child_of_type<Box>([&](Box& child) {
         if (child.is_anonymous() && !is<TableWrapper>(child)) {
             child.m_needs_layout_update = true;
+            child.m_needs_intrinsic_sizes_update = true;
         }
         return IterationDecision::Continue;
     });
 
+    // Every ancestor needs layout, but once we pass a relayout boundary, their intrinsic sizes are unaffected.
+    bool intrinsic_sizes_may_change = true;
     for (auto* ancestor = parent(); ancestor; ancestor = ancestor->parent()) {
-        if (ancestor->m_needs_layout_update)
+        if (ancestor->m_needs_layout_update && (ancestor->m_needs_intrinsic_sizes_update || !intrinsic_sizes_may_change))
             break;
         ancestor->m_needs_layout_update = true;
+
+        if (intrinsic_sizes_may_change) {
+            ancestor->m_needs_intrinsic_sizes_update = true;
+            if (auto const* box = as_if<Box>(*ancestor); box && box->is_relayout_boundary())
+                intrinsic_sizes_may_change = false;
+        }
     }
 }
 
@@ -48,7 +48,15 @@ public:
 
     bool needs_layout_update() const { return m_needs_layout_update; }
     void set_needs_layout_update(DOM::SetNeedsLayoutReason);
-    void reset_needs_layout_update() { m_needs_layout_update = false; }
+    void reset_needs_layout_update()
+    {
+        m_needs_layout_update = false;
+        m_needs_intrinsic_sizes_update = false;
+    }
+
+    // Whether any cached intrinsic sizes of this node may be stale. Unlike the need for layout, this doesn't propagate
+    // past relayout boundaries.
+    bool needs_intrinsic_sizes_update() const { return m_needs_intrinsic_sizes_update; }
 
     bool is_generated_for_pseudo_element() const { return m_generated_for.has_value(); }
     Optional<CSS::PseudoElement> generated_for_pseudo_element() const { return m_generated_for; }
@@ -144,6 +152,11 @@ public:
 
     void recompute_containing_block(Badge<DOM::Document>);
 
+    // A dense index into the layout tree, reassigned in tree order before each layout pass. LayoutState uses it to
+    // store used values in an array rather than a hash map.
+    size_t index_in_layout_tree() const { return m_index_in_layout_tree; }
+    void set_index_in_layout_tree(Badge<DOM::Document>, size_t index) { m_index_in_layout_tree = index; }
+
     [[nodiscard]] Box const* static_position_containing_block() const;
     [[nodiscard]] Box* static_position_containing_block() { return const_cast<Box*>(const_cast<Node const*>(this)->static_position_containing_block()); }
 
@@ -218,6 +231,7 @@ private:
     PaintableList m_paintable;
 
     GC::Ptr<Box> m_containing_block;
+    size_t m_index_in_layout_tree { 0 };
 
     GC::Ptr<DOM::Element> m_pseudo_element_generator;
 
@@ -231,6 +245,7 @@ private:
     bool m_has_been_wrapped_in_table_wrapper { false };
 
     bool m_needs_layout_update { false };
+    bool m_needs_intrinsic_sizes_update { false };
 
     Optional<CSS::PseudoElement> m_generated_for;
 
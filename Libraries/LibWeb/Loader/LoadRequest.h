@@ -10,6 +10,7 @@
 #include <AK/HashMap.h>
 #include <AK/Time.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibURL/Origin.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
@@ -50,6 +51,10 @@ public:
     GC::Ptr<Page> page() const { return m_page.ptr(); }
     void set_page(Page& page) { m_page = page; }
 
+    // The origin of the top-level document on whose behalf this request is made, which partitions the HTTP cache.
+    Optional<URL::Origin> const& top_level_origin() const { return m_top_level_origin; }
+    void set_top_level_origin(Optional<URL::Origin> top_level_origin) { m_top_level_origin = move(top_level_origin); }
+
     unsigned hash() const
     {
         auto body_hash = string_hash((char const*)m_body.data(), m_body.size());
@@ -86,6 +91,7 @@ private:
     ByteBuffer m_body;
     Core::ElapsedTimer m_load_timer;
     GC::Root<Page> m_page;
+    Optional<URL::Origin> m_top_level_origin;
     bool m_main_resource { false };
     bool m_store_set_cookie_headers { true };
 };
@@ -20,6 +20,8 @@ struct CornerRadius {
     {
         return horizontal_radius > 0 && vertical_radius > 0;
     }
+
+    bool operator==(CornerRadius const&) const = default;
 };
 
 struct WEB_API BorderRadiusData {
@@ -46,6 +48,8 @@ struct WEB_API BorderRadiusData {
         horizontal_radius = max(horizontal_radius, other.horizontal_radius);
         vertical_radius = max(vertical_radius, other.vertical_radius);
     }
+
+    bool operator==(BorderRadiusData const&) const = default;
 };
 
 struct CornerRadii {
@@ -58,6 +62,8 @@ struct CornerRadii {
     {
         return top_left || top_right || bottom_right || bottom_left;
     }
+
+    bool operator==(CornerRadii const&) const = default;
 };
 
 struct BorderRadiiData {
@@ -103,6 +109,8 @@ struct BorderRadiiData {
             bottom_left.as_corner(device_pixel_converter)
         };
     }
+
+    bool operator==(BorderRadiiData const&) const = default;
 };
 
 }
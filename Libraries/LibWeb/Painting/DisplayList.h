@@ -110,7 +110,14 @@ public:
     }
 
     static constexpr size_t VISUAL_VIEWPORT_TRANSFORM_INDEX = 1;
-    void set_visual_viewport_transform(Gfx::FloatMatrix4x4 t) { m_commands[VISUAL_VIEWPORT_TRANSFORM_INDEX].command.get<ApplyTransform>().matrix = t; }
+    void set_visual_viewport_transform(Gfx::FloatMatrix4x4 t)
+    {
+        m_commands[VISUAL_VIEWPORT_TRANSFORM_INDEX].command.get<ApplyTransform>().matrix = t;
+        ++m_generation;
+    }
+
+    // Bumped whenever a command is modified after recording, so that cached rasterizations can tell they're stale.
+    u64 generation() const { return m_generation; }
 
 private:
     DisplayList(double device_pixels_per_css_pixel)
@@ -121,6 +128,7 @@ private:
     AK::SegmentedVector<DisplayListCommandWithScrollAndClip, 512> m_commands;
     double m_device_pixels_per_css_pixel;
     Optional<Gfx::FloatMatrix4x4> m_visual_viewport_transform;
+    u64 m_generation { 0 };
 };
 
 }
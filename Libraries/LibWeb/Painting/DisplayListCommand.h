@@ -48,6 +48,7 @@ struct DrawGlyphRun {
     [[nodiscard]] Gfx::IntRect bounding_rect() const { return bounding_rectangle; }
     void translate_by(Gfx::IntPoint const& offset);
     void dump(StringBuilder&) const;
+    bool operator==(DrawGlyphRun const&) const = default;
 };
 
 struct FillRect {
@@ -57,6 +58,7 @@ struct FillRect {
     [[nodiscard]] Gfx::IntRect bounding_rect() const { return rect; }
     void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+    bool operator==(FillRect const&) const = default;
 };
 
 struct DrawPaintingSurface {
@@ -83,12 +85,15 @@ struct DrawScaledImmutableBitmap {
         clip_rect.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+    bool operator==(DrawScaledImmutableBitmap const&) const = default;
 };
 
 struct DrawRepeatedImmutableBitmap {
     struct Repeat {
         bool x { false };
         bool y { false };
+
+        bool operator==(Repeat const&) const = default;
     };
 
     Gfx::IntRect dst_rect;
@@ -99,24 +104,28 @@ struct DrawRepeatedImmutableBitmap {
 
     void translate_by(Gfx::IntPoint const& offset) { dst_rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+    bool operator==(DrawRepeatedImmutableBitmap const&) const = default;
 };
 
 struct Save {
     static constexpr int nesting_level_change = 1;
 
     void dump(StringBuilder&) const;
+    bool operator==(Save const&) const = default;
 };
 
 struct SaveLayer {
     static constexpr int nesting_level_change = 1;
 
     void dump(StringBuilder&) const;
+    bool operator==(SaveLayer const&) const = default;
 };
 
 struct Restore {
     static constexpr int nesting_level_change = -1;
 
     void dump(StringBuilder&) const;
+    bool operator==(Restore const&) const = default;
 };
 
 struct Translate {
@@ -124,6 +133,7 @@ struct Translate {
 
     void translate_by(Gfx::IntPoint const& offset) { delta.translate_by(offset); }
     void dump(StringBuilder&) const;
+    bool operator==(Translate const&) const = default;
 };
 
 struct AddClipRect {
@@ -133,6 +143,7 @@ struct AddClipRect {
     bool is_clip_or_mask() const { return true; }
     void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+    bool operator==(AddClipRect const&) const = default;
 };
 
 struct PushStackingContext {
@@ -163,6 +174,7 @@ struct PopStackingContext {
     static constexpr int nesting_level_change = -1;
 
     void dump(StringBuilder&) const;
+    bool operator==(PopStackingContext const&) const = default;
 };
 
 struct PaintLinearGradient {
@@ -176,6 +188,7 @@ struct PaintLinearGradient {
         gradient_rect.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+    bool operator==(PaintLinearGradient const&) const = default;
 };
 
 struct PaintOuterBoxShadow {
@@ -184,6 +197,7 @@ struct PaintOuterBoxShadow {
     [[nodiscard]] Gfx::IntRect bounding_rect() const;
     void translate_by(Gfx::IntPoint const& offset);
     void dump(StringBuilder&) const;
+    bool operator==(PaintOuterBoxShadow const&) const = default;
 };
 
 struct PaintInnerBoxShadow {
@@ -192,6 +206,7 @@ struct PaintInnerBoxShadow {
     [[nodiscard]] Gfx::IntRect bounding_rect() const;
     void translate_by(Gfx::IntPoint const& offset);
     void dump(StringBuilder&) const;
+    bool operator==(PaintInnerBoxShadow const&) const = default;
 };
 
 struct PaintTextShadow {
@@ -206,6 +221,7 @@ struct PaintTextShadow {
     [[nodiscard]] Gfx::IntRect bounding_rect() const { return { draw_location.to_type<int>(), shadow_bounding_rect.size() }; }
     void translate_by(Gfx::IntPoint const& offset) { draw_location.translate_by(offset.to_type<float>()); }
     void dump(StringBuilder&) const;
+    bool operator==(PaintTextShadow const&) const = default;
 };
 
 struct FillRectWithRoundedCorners {
@@ -216,6 +232,7 @@ struct FillRectWithRoundedCorners {
     [[nodiscard]] Gfx::IntRect bounding_rect() const { return rect; }
     void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+    bool operator==(FillRectWithRoundedCorners const&) const = default;
 };
 
 struct FillPath {
@@ -234,6 +251,7 @@ struct FillPath {
         path_bounding_rect.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+    bool operator==(FillPath const&) const = default;
 };
 
 struct StrokePath {
@@ -257,6 +275,7 @@ struct StrokePath {
         path_bounding_rect.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+    bool operator==(StrokePath const&) const = default;
 };
 
 struct DrawEllipse {
@@ -271,6 +290,7 @@ struct DrawEllipse {
         rect.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+    bool operator==(DrawEllipse const&) const = default;
 };
 
 struct FillEllipse {
@@ -284,6 +304,7 @@ struct FillEllipse {
         rect.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+    bool operator==(FillEllipse const&) const = default;
 };
 
 struct DrawLine {
@@ -300,6 +321,7 @@ struct DrawLine {
         to.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+    bool operator==(DrawLine const&) const = default;
 };
 
 struct ApplyBackdropFilter {
@@ -325,6 +347,7 @@ struct DrawRect {
 
     void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+    bool operator==(DrawRect const&) const = default;
 };
 
 struct PaintRadialGradient {
@@ -337,6 +360,7 @@ struct PaintRadialGradient {
 
     void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+    bool operator==(PaintRadialGradient const&) const = default;
 };
 
 struct PaintConicGradient {
@@ -348,6 +372,7 @@ struct PaintConicGradient {
 
     void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+    bool operator==(PaintConicGradient const&) const = default;
 };
 
 struct AddRoundedRectClip {
@@ -360,6 +385,7 @@ struct AddRoundedRectClip {
 
     void translate_by(Gfx::IntPoint const& offset) { border_rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+    bool operator==(AddRoundedRectClip const&) const = default;
 };
 
 struct AddMask {
@@ -413,6 +439,7 @@ struct ApplyOpacity {
 
     float opacity;
     void dump(StringBuilder&) const;
+    bool operator==(ApplyOpacity const&) const = default;
 };
 
 struct ApplyCompositeAndBlendingOperator {
@@ -421,6 +448,7 @@ struct ApplyCompositeAndBlendingOperator {
 
     Gfx::CompositingAndBlendingOperator compositing_and_blending_operator;
     void dump(StringBuilder&) const;
+    bool operator==(ApplyCompositeAndBlendingOperator const&) const = default;
 };
 
 struct ApplyFilter {
@@ -440,6 +468,7 @@ struct ApplyTransform {
         origin.translate_by(offset.to_type<float>());
     }
     void dump(StringBuilder&) const;
+    bool operator==(ApplyTransform const&) const = default;
 };
 
 struct ApplyMaskBitmap {
@@ -452,6 +481,7 @@ struct ApplyMaskBitmap {
         origin.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+    bool operator==(ApplyMaskBitmap const&) const = default;
 };
 
 using DisplayListCommand = Variant<
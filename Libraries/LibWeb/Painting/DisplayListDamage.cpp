@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/AffineTransform.h>
+#include <LibGfx/Matrix4x4.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListDamage.h>
+
+namespace Web::Painting {
+
+static Optional<Gfx::IntRect> command_bounding_rectangle(DisplayListCommand const& command)
+{
+    return command.visit(
+        [&](auto const& command) -> Optional<Gfx::IntRect> {
+            if constexpr (requires { command.bounding_rect(); })
+                return command.bounding_rect();
+            else
+                return {};
+        });
+}
+
+static bool commands_are_equal(DisplayListCommand const& a, DisplayListCommand const& b)
+{
+    if (a.index() != b.index())
+        return false;
+    return a.visit(
+        [&](auto const& a) -> bool {
+            using Command = RemoveCVReference<decltype(a)>;
+            // Commands that can't be compared, or that draw content which may change without the command itself
+            // changing (like a painting surface), are always considered to be different.
+            if constexpr (requires { a == a; })
+                return a == b.template get<Command>();
+            else
+                return false;
+        });
+}
+
+static bool stacking_contexts_are_equal(PushStackingContext const& a, PushStackingContext const& b)
+{
+    return a.opacity == b.opacity
+        && a.compositing_and_blending_operator == b.compositing_and_blending_operator
+        && a.isolate == b.isolate
+        && a.transform == b.transform
+        && a.clip_path == b.clip_path
+        && a.bounding_rect == b.bounding_rect;
+}
+
+static bool clip_frames_are_equal(RefPtr<ClipFrame const> const& a, RefPtr<ClipFrame const> const& b)
+{
+    if (a == b)
+        return true;
+    if (!a || !b)
+        return false;
+
+    auto const& a_clip_rects = a->clip_rects();
+    auto const& b_clip_rects = b->clip_rects();
+    if (a_clip_rects.size() != b_clip_rects.size())
+        return false;
+    for (size_t i = 0; i < a_clip_rects.size(); ++i) {
+        auto const& a_clip_rect = a_clip_rects[i];
+        auto const& b_clip_rect = b_clip_rects[i];
+        if (a_clip_rect.rect != b_clip_rect.rect
+            || a_clip_rect.corner_radii != b_clip_rect.corner_radii
+            || a_clip_rect.enclosing_scroll_frame_id != b_clip_rect.enclosing_scroll_frame_id)
+            return false;
+    }
+    return true;
+}
+
+// NOTE: This matches how the player applies transforms, which is by their 2D part around the origin.
+static Gfx::AffineTransform transform_around_origin(Gfx::FloatPoint origin, Gfx::FloatMatrix4x4 const& matrix, Gfx::IntPoint scroll_offset)
+{
+    origin.translate_by(scroll_offset.to_type<float>());
+    return Gfx::AffineTransform {}
+        .translate(origin)
+        .multiply(Gfx::extract_2d_affine_transform(matrix))
+        .translate(-origin);
+}
+
+class DisplayListDamageComputer {
+public:
+    DisplayListDamageComputer(DisplayList& old_display_list, ScrollStateSnapshotByDisplayList const& old_scroll_state, DisplayList& new_display_list, ScrollStateSnapshotByDisplayList const& new_scroll_state, ScrollStateSnapshot const& scroll_state)
+        : m_old_display_list(old_display_list)
+        , m_old_scroll_state(old_scroll_state)
+        , m_new_display_list(new_display_list)
+        , m_new_scroll_state(new_scroll_state)
+        , m_scroll_state(scroll_state)
+    {
+    }
+
+    Optional<Vector<Gfx::IntRect>> compute();
+
+private:
+    struct Level {
+        Gfx::AffineTransform transform;
+
+        // Set for stacking contexts whose bounds are known in both display lists, so that structural changes inside of
+        // them only damage those bounds.
+        struct StackingContextBounds {
+            Gfx::IntRect old_bounds;
+            Gfx::IntRect new_bounds;
+            size_t old_pop_index { 0 };
+            size_t new_pop_index { 0 };
+        };
+        Optional<StackingContextBounds> stacking_context_bounds;
+    };
+
+    Gfx::IntPoint scroll_offset(Optional<i32> scroll_frame_id) const;
+    Optional<Gfx::IntRect> stacking_context_bounds(DisplayList const&, size_t push_stacking_context_index) const;
+    void add_damage(Gfx::IntRect, Gfx::AffineTransform const&);
+    bool damage_enclosing_stacking_context();
+    bool apply_state_change(DisplayListCommand const&, Gfx::IntPoint scroll_offset);
+
+    DisplayList& m_old_display_list;
+    ScrollStateSnapshotByDisplayList const& m_old_scroll_state;
+    DisplayList& m_new_display_list;
+    ScrollStateSnapshotByDisplayList const& m_new_scroll_state;
+    ScrollStateSnapshot const& m_scroll_state;
+
+    Vector<Level> m_levels;
+    size_t m_old_index { 0 };
+    size_t m_new_index { 0 };
+    Vector<Gfx::IntRect> m_damage;
+};
+
+Gfx::IntPoint DisplayListDamageComputer::scroll_offset(Optional<i32> scroll_frame_id) const
+{
+    if (!scroll_frame_id.has_value())
+        return {};
+    auto cumulative_offset = m_scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id.value());
+    return cumulative_offset.to_type<double>().scaled(m_new_display_list.device_pixels_per_css_pixel()).to_type<int>();
+}
+
+Optional<Gfx::IntRect> DisplayListDamageComputer::stacking_context_bounds(DisplayList const& display_list, size_t push_stacking_context_index) const
+{
+    auto const& commands = display_list.commands();
+    auto const& push_stacking_context = commands[push_stacking_context_index].command.get<PushStackingContext>();
+    if (!push_stacking_context.can_aggregate_children_bounds)
+        return {};
+
+    // NOTE: This matches how the player computes the bounds of a stacking context.
+    Gfx::IntRect bounds;
+    for (auto index = push_stacking_context_index + 1; index < push_stacking_context.matching_pop_index; ++index) {
+        auto const& item = commands[index];
+        bounds.unite(command_bounding_rectangle(item.command)->translated(scroll_offset(item.scroll_frame_id)));
+    }
+    return bounds;
+}
+
+void DisplayListDamageComputer::add_damage(Gfx::IntRect rect, Gfx::AffineTransform const& transform)
+{
+    if (rect.is_empty())
+        return;
+    // Leave some room for anti-aliased edges that bleed out of the bounding rectangle.
+    m_damage.append(Gfx::enclosing_int_rect(transform.map(rect.to_type<float>())).inflated(2, 2));
+}
+
+bool DisplayListDamageComputer::damage_enclosing_stacking_context()
+{
+    auto const& level = m_levels.last();
+    if (!level.stacking_context_bounds.has_value())
+        return false;
+
+    auto const& bounds = level.stacking_context_bounds.value();
+    add_damage(bounds.old_bounds, level.transform);
+    add_damage(bounds.new_bounds, level.transform);
+    m_old_index = bounds.old_pop_index + 1;
+    m_new_index = bounds.new_pop_index + 1;
+    m_levels.take_last();
+    return true;
+}
+
+bool DisplayListDamageComputer::apply_state_change(DisplayListCommand const& command, Gfx::IntPoint scroll_offset)
+{
+    return command.visit(
+        [&](auto const& command) -> bool {
+            using Command = RemoveCVReference<decltype(command)>;
+            auto& transform = m_levels.last().transform;
+
+            if constexpr (IsSame<Command, Translate>) {
+                transform.translate(command.delta.translated(scroll_offset).template to_type<float>());
+            } else if constexpr (IsSame<Command, ApplyTransform>) {
+                transform.multiply(transform_around_origin(command.origin, command.matrix, scroll_offset));
+            } else if constexpr (IsSame<Command, PaintNestedDisplayList>) {
+                transform.translate(command.rect.location().translated(scroll_offset).template to_type<float>());
+            }
+
+            if constexpr (requires { command.nesting_level_change; }) {
+                if (command.nesting_level_change > 0) {
+                    m_levels.append({ .transform = m_levels.last().transform });
+                } else {
+                    if (m_levels.size() <= 1)
+                        return false;
+                    m_levels.take_last();
+                }
+            }
+            return true;
+        });
+}
+
+Optional<Vector<Gfx::IntRect>> DisplayListDamageComputer::compute()
+{
+    auto const& old_commands = m_old_display_list.commands();
+    auto const& new_commands = m_new_display_list.commands();
+
+    m_levels.append({});
+    while (m_old_index < old_commands.size() && m_new_index < new_commands.size()) {
+        auto const& old_item = old_commands[m_old_index];
+        auto const& new_item = new_commands[m_new_index];
+        auto const& old_command = old_item.command;
+        auto const& new_command = new_item.command;
+
+        if (old_command.index() != new_command.index()
+            || old_item.scroll_frame_id != new_item.scroll_frame_id
+            || !clip_frames_are_equal(old_item.clip_frame, new_item.clip_frame)) {
+            if (!damage_enclosing_stacking_context())
+                return {};
+            continue;
+        }
+
+        auto offset = scroll_offset(new_item.scroll_frame_id);
+
+        if (old_command.has<PushStackingContext>()) {
+            auto const& old_push_stacking_context = old_command.get<PushStackingContext>();
+            auto const& new_push_stacking_context = new_command.get<PushStackingContext>();
+            auto old_bounds = stacking_context_bounds(m_old_display_list, m_old_index);
+            auto new_bounds = stacking_context_bounds(m_new_display_list, m_new_index);
+
+            if (stacking_contexts_are_equal(old_push_stacking_context, new_push_stacking_context)) {
+                auto transform = m_levels.last().transform;
+                transform.multiply(transform_around_origin(new_push_stacking_context.transform.origin, new_push_stacking_context.transform.matrix, offset));
+                Level level { .transform = transform };
+                if (old_bounds.has_value() && new_bounds.has_value()) {
+                    level.stacking_context_bounds = Level::StackingContextBounds {
+                        .old_bounds = old_bounds.release_value(),
+                        .new_bounds = new_bounds.release_value(),
+                        .old_pop_index = old_push_stacking_context.matching_pop_index,
+                        .new_pop_index = new_push_stacking_context.matching_pop_index,
+                    };
+                }
+                m_levels.append(move(level));
+                ++m_old_index;
+                ++m_new_index;
+                continue;
+            }
+
+            // The stacking context itself changed (e.g. its transform or opacity is being animated), so everything it
+            // painted before and everything it paints now is damaged.
+            if (!old_bounds.has_value() || !new_bounds.has_value()) {
+                if (!damage_enclosing_stacking_context())
+                    return {};
+                continue;
+            }
+            auto old_transform = m_levels.last().transform;
+            old_transform.multiply(transform_around_origin(old_push_stacking_context.transform.origin, old_push_stacking_context.transform.matrix, offset));
+            auto new_transform = m_levels.last().transform;
+            new_transform.multiply(transform_around_origin(new_push_stacking_context.transform.origin, new_push_stacking_context.transform.matrix, offset));
+            add_damage(*old_bounds, old_transform);
+            add_damage(*new_bounds, new_transform);
+            m_old_index = old_push_stacking_context.matching_pop_index + 1;
+            m_new_index = new_push_stacking_context.matching_pop_index + 1;
+            continue;
+        }
+
+        auto are_equal = commands_are_equal(old_command, new_command);
+        if (old_command.has<PaintNestedDisplayList>()) {
+            auto const& old_nested = old_command.get<PaintNestedDisplayList>();
+            auto const& new_nested = new_command.get<PaintNestedDisplayList>();
+            are_equal = old_nested.display_list
+                && old_nested.display_list == new_nested.display_list
+                && old_nested.rect == new_nested.rect
+                && m_old_scroll_state.get(*old_nested.display_list) == m_new_scroll_state.get(*new_nested.display_list);
+        }
+
+        if (!are_equal) {
+            // A command that only paints inside of its bounding rectangle damages its old and new bounds. Anything else
+            // may affect how the commands after it are painted.
+            auto old_rect = command_bounding_rectangle(old_command);
+            auto new_rect = command_bounding_rectangle(new_command);
+            if (!old_rect.has_value() || !new_rect.has_value() || old_command.has<PaintNestedDisplayList>()) {
+                if (!damage_enclosing_stacking_context())
+                    return {};
+                continue;
+            }
+            add_damage(old_rect->translated(offset), m_levels.last().transform);
+            add_damage(new_rect->translated(offset), m_levels.last().transform);
+        }
+
+        if (!apply_state_change(new_command, offset))
+            return {};
+        ++m_old_index;
+        ++m_new_index;
+    }
+
+    if (m_old_index != old_commands.size() || m_new_index != new_commands.size())
+        return {};
+    return move(m_damage);
+}
+
+Optional<Vector<Gfx::IntRect>> compute_display_list_damage(
+    DisplayList& old_display_list, ScrollStateSnapshotByDisplayList const& old_scroll_state,
+    DisplayList& new_display_list, ScrollStateSnapshotByDisplayList const& new_scroll_state)
+{
+    // A display list that's modified in place no longer has its previous commands around to compare against.
+    if (&old_display_list == &new_display_list)
+        return {};
+    if (old_display_list.device_pixels_per_css_pixel() != new_display_list.device_pixels_per_css_pixel())
+        return {};
+
+    // Scrolling moves everything in a scroll frame at once, so there's nothing to gain from diffing.
+    auto old_scroll_state_snapshot = old_scroll_state.get(old_display_list).value_or({});
+    auto new_scroll_state_snapshot = new_scroll_state.get(new_display_list).value_or({});
+    if (old_scroll_state_snapshot != new_scroll_state_snapshot)
+        return {};
+
+    DisplayListDamageComputer computer { old_display_list, old_scroll_state, new_display_list, new_scroll_state, new_scroll_state_snapshot };
+    return computer.compute();
+}
+
+}
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibGfx/Rect.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::Painting {
+
+// Compares two recordings of the same page and returns the device pixel rectangles that may be painted differently
+// between them. If the recordings differ in a way that can't be narrowed down to a region, nothing is returned and the
+// whole surface has to be repainted.
+//
+// Commands are matched up in recording order. A command that changed in place damages its old and new bounds; a
+// structural change (commands added, removed or reordered) damages the bounds of the enclosing stacking context.
+Optional<Vector<Gfx::IntRect>> compute_display_list_damage(
+    DisplayList& old_display_list, ScrollStateSnapshotByDisplayList const& old_scroll_state,
+    DisplayList& new_display_list, ScrollStateSnapshotByDisplayList const& new_scroll_state);
+
+}
@@ -37,6 +37,7 @@ struct StackingContextTransform {
     StackingContextTransform(Gfx::FloatPoint origin, Gfx::FloatMatrix4x4 matrix, float scale);
 
     [[nodiscard]] bool is_identity() const { return matrix.is_identity(); }
+    bool operator==(StackingContextTransform const&) const = default;
 };
 
 class WEB_API DisplayListRecorder {
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <core/SkCanvas.h>
+#include <core/SkImage.h>
+#include <core/SkPaint.h>
+
+#include <AK/Atomic.h>
+#include <LibCore/System.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListDamage.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/TileRasterizer.h>
+
+namespace Web::Painting {
+
+static constexpr unsigned max_worker_count = 8;
+
+TileRasterizer::TileRasterizer()
+{
+    auto worker_count = clamp(Core::System::hardware_concurrency(), 1u, max_worker_count);
+    for (unsigned i = 0; i < worker_count; ++i) {
+        m_workers.append({
+            .thread = MUST(Threading::WorkerThread<Error>::create("Rasterizer"sv)),
+            .player = make<DisplayListPlayerSkia>(),
+        });
+    }
+}
+
+TileRasterizer::~TileRasterizer() = default;
+
+static bool display_list_reads_back_pixels(DisplayList const& display_list)
+{
+    for (auto const& item : display_list.commands()) {
+        auto const& command = item.command;
+
+        // Taking a snapshot of a shared surface is not thread-safe, and a backdrop filter would only see the part of
+        // the backdrop that is inside its own tile.
+        if (command.has<DrawPaintingSurface>() || command.has<ApplyBackdropFilter>())
+            return true;
+
+        if (auto const* nested = command.get_pointer<PaintNestedDisplayList>(); nested && nested->display_list && display_list_reads_back_pixels(*nested->display_list))
+            return true;
+    }
+    return false;
+}
+
+bool TileRasterizer::can_rasterize_in_tiles(DisplayList const& display_list, Gfx::IntSize size)
+{
+    // A surface that fits into a single tile gains nothing from being split up.
+    if (size.width() <= tile_size && size.height() <= tile_size)
+        return false;
+    return !display_list_reads_back_pixels(display_list);
+}
+
+bool TileRasterizer::tiles_are_up_to_date(DisplayList const& display_list, ScrollStateSnapshotByDisplayList const& scroll_state_snapshots, Gfx::IntSize size) const
+{
+    if (m_tiles_size != size || m_rasterized_display_list.ptr() != &display_list || m_rasterized_display_list_generation != display_list.generation())
+        return false;
+
+    if (m_rasterized_scroll_state_snapshots.size() != scroll_state_snapshots.size())
+        return false;
+    for (auto const& it : scroll_state_snapshots) {
+        auto rasterized_snapshot = m_rasterized_scroll_state_snapshots.get(it.key);
+        if (!rasterized_snapshot.has_value() || *rasterized_snapshot != it.value)
+            return false;
+    }
+    return true;
+}
+
+void TileRasterizer::create_tiles(Gfx::IntSize size)
+{
+    m_tiles.clear_with_capacity();
+    m_tiles_size = size;
+
+    for (int y = 0; y < size.height(); y += tile_size) {
+        for (int x = 0; x < size.width(); x += tile_size) {
+            auto rect = Gfx::IntRect { x, y, min(tile_size, size.width() - x), min(tile_size, size.height() - y) };
+            auto surface = Gfx::PaintingSurface::create_with_size(nullptr, rect.size(), Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied);
+            m_tiles.append({ rect, move(surface) });
+        }
+    }
+}
+
+Vector<size_t> TileRasterizer::damaged_tiles(Optional<Vector<Gfx::IntRect>> const& damage) const
+{
+    Vector<size_t> tile_indices;
+    if (!damage.has_value()) {
+        tile_indices.ensure_capacity(m_tiles.size());
+        for (size_t i = 0; i < m_tiles.size(); ++i)
+            tile_indices.unchecked_append(i);
+        return tile_indices;
+    }
+
+    auto columns = ceil_div(m_tiles_size.width(), tile_size);
+    Vector<bool> is_damaged;
+    is_damaged.resize(m_tiles.size());
+    for (auto rect : *damage) {
+        rect.intersect({ {}, m_tiles_size });
+        if (rect.is_empty())
+            continue;
+        for (auto row = rect.top() / tile_size; row <= (rect.bottom() - 1) / tile_size; ++row) {
+            for (auto column = rect.left() / tile_size; column <= (rect.right() - 1) / tile_size; ++column)
+                is_damaged[row * columns + column] = true;
+        }
+    }
+
+    for (size_t i = 0; i < m_tiles.size(); ++i) {
+        if (is_damaged[i])
+            tile_indices.append(i);
+    }
+    return tile_indices;
+}
+
+void TileRasterizer::rasterize(DisplayList& display_list, ScrollStateSnapshotByDisplayList const& scroll_state_snapshots, Gfx::PaintingSurface& target)
+{
+    auto size = target.size();
+
+    if (!tiles_are_up_to_date(display_list, scroll_state_snapshots, size)) {
+        Optional<Vector<Gfx::IntRect>> damage;
+        if (m_tiles_size != size)
+            create_tiles(size);
+        else if (m_rasterized_display_list)
+            damage = compute_display_list_damage(*m_rasterized_display_list, m_rasterized_scroll_state_snapshots, display_list, scroll_state_snapshots);
+
+        auto tiles_to_rasterize = damaged_tiles(damage);
+
+        // Every worker keeps picking the next tile that hasn't been claimed yet until there are none left.
+        Atomic<size_t> next_tile_index { 0 };
+        for (auto& worker : m_workers) {
+            auto started = worker.thread->start_task([&]() -> ErrorOr<void> {
+                for (;;) {
+                    auto index = next_tile_index.fetch_add(1);
+                    if (index >= tiles_to_rasterize.size())
+                        return {};
+
+                    auto& tile = m_tiles[tiles_to_rasterize[index]];
+                    auto& canvas = tile.surface->canvas();
+                    canvas.clear(SK_ColorTRANSPARENT);
+                    canvas.save();
+                    canvas.translate(-tile.rect.x(), -tile.rect.y());
+                    worker.player->execute(display_list, ScrollStateSnapshotByDisplayList { scroll_state_snapshots }, tile.surface);
+                    canvas.restore();
+                }
+            });
+            VERIFY(started);
+        }
+
+        for (auto& worker : m_workers)
+            MUST(worker.thread->wait_until_task_is_finished());
+
+        m_rasterized_display_list = display_list;
+        m_rasterized_display_list_generation = display_list.generation();
+        m_rasterized_scroll_state_snapshots = scroll_state_snapshots;
+    }
+
+    target.lock_context();
+    auto& canvas = target.canvas();
+    SkPaint paint;
+    paint.setBlendMode(SkBlendMode::kSrc);
+    for (auto const& tile : m_tiles)
+        canvas.drawImage(tile.surface->sk_image_snapshot<sk_sp<SkImage>>(), tile.rect.x(), tile.rect.y(), SkSamplingOptions(), &paint);
+    target.flush();
+    target.unlock_context();
+}
+
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/Rect.h>
+#include <LibThreading/WorkerThread.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/Painting/ScrollState.h>
+
+namespace Web::Painting {
+
+// Rasterizes a display list on several threads at once by splitting the target surface into tiles.
+//
+// Every tile is replayed through its own DisplayListPlayerSkia into its own surface, so the player's regular culling
+// skips all commands that fall outside of the tile. The tile surfaces are kept around between frames and composited
+// into the target. When a new display list only differs from the previous one in a few places, only the tiles that
+// touch the damaged regions are rasterized again.
+class TileRasterizer {
+    AK_MAKE_NONCOPYABLE(TileRasterizer);
+    AK_MAKE_NONMOVABLE(TileRasterizer);
+
+public:
+    static constexpr int tile_size = 512;
+
+    TileRasterizer();
+    ~TileRasterizer();
+
+    // Display lists that read back from surfaces shared with other threads, or from what's already been painted, have
+    // to be replayed in one go on a single thread.
+    static bool can_rasterize_in_tiles(DisplayList const&, Gfx::IntSize);
+
+    void rasterize(DisplayList&, ScrollStateSnapshotByDisplayList const&, Gfx::PaintingSurface&);
+
+private:
+    struct Tile {
+        Gfx::IntRect rect;
+        NonnullRefPtr<Gfx::PaintingSurface> surface;
+    };
+
+    struct Worker {
+        NonnullOwnPtr<Threading::WorkerThread<Error>> thread;
+        NonnullOwnPtr<DisplayListPlayerSkia> player;
+    };
+
+    bool tiles_are_up_to_date(DisplayList const&, ScrollStateSnapshotByDisplayList const&, Gfx::IntSize) const;
+    void create_tiles(Gfx::IntSize);
+    Vector<size_t> damaged_tiles(Optional<Vector<Gfx::IntRect>> const& damage) const;
+
+    Vector<Worker> m_workers;
+    Vector<Tile> m_tiles;
+    Gfx::IntSize m_tiles_size;
+
+    // What the tiles were last rasterized from.
+    RefPtr<DisplayList> m_rasterized_display_list;
+    u64 m_rasterized_display_list_generation { 0 };
+    ScrollStateSnapshotByDisplayList m_rasterized_scroll_state_snapshots;
+};
+
+}
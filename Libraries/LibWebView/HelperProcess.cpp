@@ -203,9 +203,14 @@ ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process()
 {
     Vector<ByteString> arguments;
 
-    for (auto const& certificate : WebView::Application::browser_options().certificates)
+    auto const& browser_options = WebView::Application::browser_options();
+
+    for (auto const& certificate : browser_options.certificates)
         arguments.append(ByteString::formatted("--certificate={}", certificate));
 
+    if (browser_options.enable_http_disk_cache == WebView::EnableHTTPDiskCache::Yes)
+        arguments.append("--enable-http-disk-cache"sv);
+
     if (auto server = mach_server_name(); server.has_value()) {
         arguments.append("--mach-server-name"sv);
         arguments.append(server.value());
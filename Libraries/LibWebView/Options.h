@@ -52,6 +52,11 @@ enum class EnableAutoplay {
     Yes,
 };
 
+enum class EnableHTTPDiskCache {
+    No,
+    Yes,
+};
+
 struct SystemDNS { };
 struct DNSOverTLS {
     ByteString server_address;
@@ -80,6 +85,7 @@ struct BrowserOptions {
     AllowPopups allow_popups { AllowPopups::No };
     DisableScripting disable_scripting { DisableScripting::No };
     DisableSQLDatabase disable_sql_database { DisableSQLDatabase::No };
+    EnableHTTPDiskCache enable_http_disk_cache { EnableHTTPDiskCache::No };
     Optional<ProcessType> debug_helper_process {};
     Optional<ProcessType> profile_helper_process {};
     Optional<ByteString> webdriver_content_ipc_path {};
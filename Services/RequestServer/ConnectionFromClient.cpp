@@ -21,6 +21,7 @@
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Message.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/DiskCache.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #ifdef AK_OS_WINDOWS
 // needed because curl.h includes winsock2.h
@@ -31,6 +32,7 @@
 namespace RequestServer {
 
 ByteString g_default_certificate_path;
+OwnPtr<DiskCache> g_disk_cache;
 static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
 static IDAllocator s_client_ids;
 static long s_connect_timeout_seconds = 90L;
@@ -123,6 +125,22 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
     NonnullRefPtr<Core::Notifier> write_notifier;
     bool done_fetching { false };
 
+    ByteString method;
+    HTTP::HeaderMap request_headers;
+
+    // The disk cache key of this request, if its response may be stored in the disk cache.
+    Optional<ByteString> cache_key;
+    UnixDateTime request_time;
+
+    // A stale disk cache entry that this request is revalidating with the origin server.
+    Optional<DiskCache::Entry> cache_entry;
+    bool is_revalidated_from_cache { false };
+
+    // The response body collected so far, if the response is to be stored in the disk cache.
+    bool should_store_in_cache { false };
+    ByteBuffer cache_body;
+    UnixDateTime response_time;
+
     ActiveRequest(ConnectionFromClient& client, CURLM* multi, CURL* easy, i32 request_id, int writer_fd)
         : multi(multi)
         , easy(easy)
@@ -187,9 +205,12 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         if (writer_fd > 0)
             MUST(Core::System::close(writer_fd));
 
-        auto result = curl_multi_remove_handle(multi, easy);
-        VERIFY(result == CURLM_OK);
-        curl_easy_cleanup(easy);
+        // Requests served from the disk cache never had a curl handle.
+        if (easy) {
+            auto result = curl_multi_remove_handle(multi, easy);
+            VERIFY(result == CURLM_OK);
+            curl_easy_cleanup(easy);
+        }
 
         for (auto* string_list : curl_string_lists)
             curl_slist_free_all(string_list);
@@ -203,8 +224,64 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         long http_status_code = 0;
         auto result = curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &http_status_code);
         VERIFY(result == CURLE_OK);
+
+        if (cache_key.has_value()) {
+            response_time = UnixDateTime::now();
+
+            // The origin server confirmed that our stored response is still valid, so we serve its (freshened) copy
+            // instead of the empty 304 response body.
+            if (cache_entry.has_value() && http_status_code == 304) {
+                g_disk_cache->freshen_entry(*cache_entry, headers, request_time, response_time);
+                is_revalidated_from_cache = true;
+
+                client->async_headers_became_available(request_id, cache_entry->response_headers, cache_entry->status_code, cache_entry->reason_phrase);
+                return;
+            }
+
+            should_store_in_cache = g_disk_cache->is_cacheable(method, request_headers, http_status_code, headers);
+
+            // The stored response was superseded by a response we are not allowed to store.
+            if (cache_entry.has_value() && !should_store_in_cache)
+                g_disk_cache->remove_entry(*cache_key);
+        }
+
         client->async_headers_became_available(request_id, headers, http_status_code, reason_phrase);
     }
+
+    void write_body_from_cache(ReadonlyBytes body)
+    {
+        auto maybe_write_error = [&] -> ErrorOr<void> {
+            TRY(send_buffer.write_until_depleted(body));
+            return write_queued_bytes_without_blocking();
+        }();
+
+        if (maybe_write_error.is_error()) {
+            dbgln("Warning: Failed to write cached response data (it's likely the client disappeared): {}", maybe_write_error.error());
+            return;
+        }
+
+        downloaded_so_far += body.size();
+    }
+
+    void store_in_cache_if_needed()
+    {
+        if (!should_store_in_cache || !cache_key.has_value())
+            return;
+
+        long http_status_code = 0;
+        auto result = curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &http_status_code);
+        VERIFY(result == CURLE_OK);
+
+        g_disk_cache->store_entry({
+            .cache_key = *cache_key,
+            .status_code = static_cast<u32>(http_status_code),
+            .reason_phrase = reason_phrase,
+            .response_headers = headers,
+            .request_time = request_time,
+            .response_time = response_time,
+            .body = move(cache_body),
+        });
+    }
 };
 
 size_t ConnectionFromClient::on_header_received(void* buffer, size_t size, size_t nmemb, void* user_data)
@@ -247,6 +324,20 @@ size_t ConnectionFromClient::on_data_received(void* buffer, size_t size, size_t
     size_t total_size = size * nmemb;
     ReadonlyBytes bytes { static_cast<u8 const*>(buffer), total_size };
 
+    // The client is being sent the body of our stored response instead.
+    if (request->is_revalidated_from_cache)
+        return total_size;
+
+    if (request->should_store_in_cache) {
+        if (request->cache_body.size() + total_size > g_disk_cache->maximum_entry_size()) {
+            request->should_store_in_cache = false;
+            request->cache_body.clear();
+        } else if (request->cache_body.try_append(bytes).is_error()) {
+            request->should_store_in_cache = false;
+            request->cache_body.clear();
+        }
+    }
+
     auto maybe_write_error = [&] -> ErrorOr<void> {
         TRY(request->send_buffer.write_some(bytes));
         return request->write_queued_bytes_without_blocking();
@@ -456,14 +547,50 @@ void ConnectionFromClient::set_use_system_dns()
 }
 
 #ifdef AK_OS_WINDOWS
-void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData)
+void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Optional<URL::Origin>)
 {
     VERIFY(0 && "RequestServer::ConnectionFromClient::start_request is not implemented");
 }
 #else
-void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data)
+void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, Optional<URL::Origin> top_level_origin)
 {
     dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: start_request({}, {})", request_id, url);
+
+    Optional<ByteString> cache_key;
+    if (g_disk_cache)
+        cache_key = DiskCache::cache_key_for_request(url, top_level_origin);
+
+    if (!cache_key.has_value() || !DiskCache::may_use_stored_response(method, request_headers)) {
+        start_network_request(request_id, move(method), move(url), move(request_headers), move(request_body), proxy_data, move(cache_key), {});
+        return;
+    }
+
+    g_disk_cache->open_entry(*cache_key, [weak_this = make_weak_ptr<ConnectionFromClient>(), request_id, method = move(method), url = move(url), request_headers = move(request_headers), request_body = move(request_body), proxy_data, cache_key](Optional<DiskCache::Entry> cache_entry) mutable {
+        auto connection = weak_this.strong_ref();
+        if (!connection)
+            return;
+
+        Optional<DiskCache::Entry> stale_cache_entry;
+
+        if (cache_entry.has_value()) {
+            if (DiskCache::is_fresh(*cache_entry, request_headers)) {
+                connection->respond_from_disk_cache(request_id, url, cache_entry.release_value(), request_headers);
+                return;
+            }
+
+            // If the client is revalidating a copy of its own, we pass its conditional request through untouched.
+            if (!request_headers.contains("If-None-Match"sv) && !request_headers.contains("If-Modified-Since"sv)) {
+                if (DiskCache::add_conditional_request_headers(*cache_entry, request_headers))
+                    stale_cache_entry = cache_entry.release_value();
+            }
+        }
+
+        connection->start_network_request(request_id, move(method), move(url), move(request_headers), move(request_body), proxy_data, move(cache_key), move(stale_cache_entry));
+    });
+}
+
+void ConnectionFromClient::start_network_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, Optional<ByteString> cache_key, Optional<DiskCache::Entry> stale_cache_entry)
+{
     auto host = url.serialized_host().to_byte_string();
 
     m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA }, { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally })
@@ -472,7 +599,7 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             // FIXME: Implement timing info for DNS lookup failure.
             async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
         })
-        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data](auto const& dns_result) mutable {
+        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data, cache_key = move(cache_key), stale_cache_entry = move(stale_cache_entry)](auto const& dns_result) mutable {
             if (dns_result->is_empty() || !dns_result->has_cached_addresses()) {
                 dbgln("StartRequest: DNS lookup failed for '{}'", host);
                 // FIXME: Implement timing info for DNS lookup failure.
@@ -502,6 +629,14 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             auto request = make<ActiveRequest>(*this, m_curl_multi, easy, request_id, writer_fd);
             request->url = url.to_string();
 
+            if (cache_key.has_value()) {
+                request->method = method;
+                request->request_headers = request_headers;
+                request->cache_key = move(cache_key);
+                request->request_time = UnixDateTime::now();
+                request->cache_entry = move(stale_cache_entry);
+            }
+
             auto set_option = [easy](auto option, auto value) {
                 auto result = curl_easy_setopt(easy, option, value);
                 if (result != CURLE_OK)
@@ -585,6 +720,40 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             m_active_requests.set(request_id, move(request));
         });
 }
+
+void ConnectionFromClient::respond_from_disk_cache(i32 request_id, URL::URL const& url, DiskCache::Entry cache_entry, HTTP::HeaderMap const& request_headers)
+{
+    auto fds_or_error = Core::System::pipe2(O_NONBLOCK);
+    if (fds_or_error.is_error()) {
+        dbgln("StartRequest: Failed to create pipe: {}", fds_or_error.error());
+        return;
+    }
+
+    auto fds = fds_or_error.release_value();
+    auto writer_fd = fds[1];
+    auto reader_fd = fds[0];
+    async_request_started(request_id, IPC::File::adopt_fd(reader_fd));
+
+    auto request = make<ActiveRequest>(*this, m_curl_multi, nullptr, request_id, writer_fd);
+    request->url = url.to_string();
+    request->got_all_headers = true;
+
+    // A fresh stored response satisfies the client's own conditional request, so we can tell it that its copy is
+    // still good without contacting the origin server.
+    if (DiskCache::is_not_modified(cache_entry, request_headers)) {
+        async_headers_became_available(request_id, cache_entry.response_headers, 304, "Not Modified"_string);
+    } else {
+        async_headers_became_available(request_id, cache_entry.response_headers, cache_entry.status_code, cache_entry.reason_phrase);
+        request->write_body_from_cache(cache_entry.body);
+    }
+
+    // FIXME: Implement timing info for responses served from the disk cache.
+    async_request_finished(request_id, request->downloaded_so_far, {}, {});
+
+    auto& request_reference = *request;
+    m_active_requests.set(request_id, move(request));
+    request_reference.notify_about_fetching_completion();
+}
 #endif
 
 static Requests::NetworkError map_curl_code_to_network_error(CURLcode const& code)
@@ -712,6 +881,9 @@ void ConnectionFromClient::check_active_requests()
             auto timing_info = get_timing_info_from_curl_easy_handle(msg->easy_handle);
             request->flush_headers_if_needed();
 
+            if (request->is_revalidated_from_cache)
+                request->write_body_from_cache(request->cache_entry->body);
+
             auto result_code = msg->data.result;
 
             // HTTPS servers might terminate their connection without proper notice of shutdown - i.e. they do not send
@@ -732,6 +904,9 @@ void ConnectionFromClient::check_active_requests()
                 }
             }
 
+            if (request_was_successful)
+                request->store_in_cache_if_needed();
+
             async_request_finished(request->request_id, request->downloaded_so_far, timing_info, network_error);
         }
 
@@ -10,6 +10,7 @@
 #include <LibDNS/Resolver.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibWebSocket/WebSocket.h>
+#include <RequestServer/DiskCache.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #include <RequestServer/RequestServerEndpoint.h>
 
@@ -44,7 +45,7 @@ private:
     virtual Messages::RequestServer::IsSupportedProtocolResponse is_supported_protocol(ByteString) override;
     virtual void set_dns_server(ByteString host_or_address, u16 port, bool use_tls, bool validate_dnssec_locally) override;
     virtual void set_use_system_dns() override;
-    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData) override;
+    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Optional<URL::Origin>) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(i32) override;
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(i32, ByteString, ByteString) override;
     virtual void ensure_connection(URL::URL url, ::RequestServer::CacheLevel cache_level) override;
@@ -61,6 +62,9 @@ private:
 
     static ErrorOr<IPC::File> create_client_socket();
 
+    void start_network_request(i32 request_id, ByteString method, URL::URL, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData, Optional<ByteString> cache_key, Optional<DiskCache::Entry> stale_cache_entry);
+    void respond_from_disk_cache(i32 request_id, URL::URL const&, DiskCache::Entry, HTTP::HeaderMap const& request_headers);
+
     static int on_socket_callback(void*, int sockfd, int what, void* user_data, void*);
     static int on_timeout_callback(void*, long timeout_ms, void* user_data);
     static size_t on_header_received(void* buffer, size_t size, size_t nmemb, void* user_data);
@@ -77,6 +81,8 @@ private:
     ByteString m_alt_svc_cache_path;
 };
 
+extern OwnPtr<DiskCache> g_disk_cache;
+
 // FIXME: Find a good home for this
 ByteString build_curl_resolve_list(DNS::LookupResult const&, StringView host, u16 port);
 constexpr inline uintptr_t websocket_private_tag = 0x1;
@@ -0,0 +1,730 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <AK/Hex.h>
+#include <AK/MemoryStream.h>
+#include <AK/QuickSort.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCrypto/Hash/SHA1.h>
+#include <LibThreading/BackgroundAction.h>
+#include <LibURL/Site.h>
+#include <RequestServer/DiskCache.h>
+
+namespace RequestServer {
+
+static constexpr u32 cache_entry_magic = 0x4C424843; // "LBHC"
+static constexpr u32 cache_entry_version = 2;
+static constexpr auto temporary_file_suffix = ".tmp"sv;
+
+// https://httpwg.org/specs/rfc9111.html#cache-request-directive
+// https://httpwg.org/specs/rfc9111.html#cache-response-directive
+static Optional<StringView> find_cache_control_directive(HTTP::HeaderMap const& headers, StringView name)
+{
+    auto cache_control = headers.get("Cache-Control"sv);
+    if (!cache_control.has_value())
+        return {};
+
+    Optional<StringView> result;
+
+    cache_control->view().for_each_split_view(',', SplitBehavior::Nothing, [&](StringView directive) {
+        if (result.has_value())
+            return;
+
+        directive = directive.trim_whitespace();
+
+        auto equals_index = directive.find('=');
+        auto directive_name = directive.substring_view(0, equals_index.value_or(directive.length())).trim_whitespace();
+        if (!directive_name.equals_ignoring_ascii_case(name))
+            return;
+
+        if (!equals_index.has_value()) {
+            result = ""sv;
+            return;
+        }
+
+        auto value = directive.substring_view(*equals_index + 1).trim_whitespace();
+        if (value.length() >= 2 && value.starts_with('"') && value.ends_with('"'))
+            value = value.substring_view(1, value.length() - 2);
+        result = value;
+    });
+
+    return result;
+}
+
+static bool has_cache_control_directive(HTTP::HeaderMap const& headers, StringView name)
+{
+    return find_cache_control_directive(headers, name).has_value();
+}
+
+static Optional<AK::Duration> cache_control_seconds(HTTP::HeaderMap const& headers, StringView name)
+{
+    auto value = find_cache_control_directive(headers, name);
+    if (!value.has_value())
+        return {};
+
+    // A cache that receives a delta-seconds value larger than the largest integer it can represent SHOULD consider the
+    // value to be 2147483648 (2^31) or the greatest positive integer it can conveniently represent.
+    if (auto seconds = value->to_number<u64>(); seconds.has_value())
+        return AK::Duration::from_seconds(static_cast<i64>(min(*seconds, 2147483648ull)));
+    return {};
+}
+
+// https://httpwg.org/specs/rfc9110.html#http.date
+static Optional<UnixDateTime> parse_http_date(HTTP::HeaderMap const& headers, StringView name)
+{
+    auto value = headers.get(name);
+    if (!value.has_value())
+        return {};
+
+    // FIXME: Recipients are also required to accept the obsolete RFC 850 and asctime() date formats.
+    return UnixDateTime::parse("%a, %d %b %Y %H:%M:%S GMT"sv, *value, true);
+}
+
+// https://httpwg.org/specs/rfc9110.html#overview.of.status.codes
+static bool is_heuristically_cacheable_status(u32 status_code)
+{
+    switch (status_code) {
+    case 200:
+    case 203:
+    case 204:
+    case 206:
+    case 300:
+    case 301:
+    case 308:
+    case 404:
+    case 405:
+    case 410:
+    case 414:
+    case 501:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// https://httpwg.org/specs/rfc9111.html#storing.fields
+static bool is_exempted_for_storage(StringView header_name)
+{
+    return header_name.is_one_of_ignoring_ascii_case(
+        "Connection"sv,
+        "Proxy-Connection"sv,
+        "Keep-Alive"sv,
+        "TE"sv,
+        "Transfer-Encoding"sv,
+        "Upgrade"sv);
+}
+
+// AD-HOC: Cookies were handed to the cookie jar when the response was first received. Replaying them on every cache hit
+//         would bring back cookies that the user or the server have since cleared, and would keep credentials on disk.
+static bool is_cookie_header(StringView header_name)
+{
+    return header_name.is_one_of_ignoring_ascii_case("Set-Cookie"sv, "Set-Cookie2"sv);
+}
+
+// https://httpwg.org/specs/rfc9111.html#update
+static bool is_exempted_for_updating(StringView header_name)
+{
+    return is_exempted_for_storage(header_name) || header_name.equals_ignoring_ascii_case("Content-Length"sv);
+}
+
+// https://httpwg.org/specs/rfc9111.html#calculating.freshness.lifetime
+static AK::Duration freshness_lifetime(DiskCache::Entry const& entry)
+{
+    auto const& headers = entry.response_headers;
+
+    // - If the cache is shared and the s-maxage response directive is present, use its value, or
+    // - If the max-age response directive is present, use its value, or
+    if (auto max_age = cache_control_seconds(headers, "max-age"sv); max_age.has_value())
+        return *max_age;
+
+    auto date = parse_http_date(headers, "Date"sv).value_or(entry.response_time);
+
+    // - If the Expires response header field is present, use its value minus the value of the Date response header
+    //   field (using the time the message was received if it is not present, as per Section 6.6.1 of [HTTP]), or
+    if (headers.contains("Expires"sv)) {
+        // A cache recipient MUST interpret invalid date formats, especially the value "0", as representing a time in
+        // the past (i.e., "already expired").
+        auto expires = parse_http_date(headers, "Expires"sv);
+        if (!expires.has_value() || *expires < date)
+            return AK::Duration::zero();
+        return *expires - date;
+    }
+
+    // - Otherwise, no explicit expiration time is present in the response. A heuristic freshness lifetime might be
+    //   applicable; see Section 4.2.2.
+    // https://httpwg.org/specs/rfc9111.html#heuristic.freshness
+    if (is_heuristically_cacheable_status(entry.status_code)) {
+        // If the response has a Last-Modified header field, caches are encouraged to use a heuristic expiration value
+        // that is no more than some fraction of the interval since that time. A typical setting of this fraction
+        // might be 10%.
+        if (auto last_modified = parse_http_date(headers, "Last-Modified"sv); last_modified.has_value() && *last_modified < date)
+            return AK::Duration::from_seconds((date - *last_modified).to_seconds() / 10);
+    }
+
+    return AK::Duration::zero();
+}
+
+// https://httpwg.org/specs/rfc9111.html#age.calculations
+static AK::Duration current_age(DiskCache::Entry const& entry)
+{
+    auto const& headers = entry.response_headers;
+
+    auto age_value = AK::Duration::zero();
+    if (auto age = headers.get("Age"sv); age.has_value()) {
+        if (auto seconds = age->to_number<u32>(); seconds.has_value())
+            age_value = AK::Duration::from_seconds(*seconds);
+    }
+
+    auto date_value = parse_http_date(headers, "Date"sv).value_or(entry.response_time);
+    auto now = UnixDateTime::now();
+
+    auto apparent_age = max(AK::Duration::zero(), entry.response_time - date_value);
+
+    auto response_delay = entry.response_time - entry.request_time;
+    auto corrected_age_value = age_value + response_delay;
+
+    auto corrected_initial_age = max(apparent_age, corrected_age_value);
+
+    auto resident_time = now - entry.response_time;
+    return corrected_initial_age + resident_time;
+}
+
+ErrorOr<NonnullOwnPtr<DiskCache>> DiskCache::create(LexicalPath directory, u64 maximum_size)
+{
+    auto disk_cache = adopt_own(*new DiskCache(move(directory), maximum_size));
+    TRY(disk_cache->build_index());
+    return disk_cache;
+}
+
+DiskCache::DiskCache(LexicalPath directory, u64 maximum_size)
+    : m_directory(move(directory))
+    , m_maximum_size(maximum_size)
+{
+}
+
+ErrorOr<void> DiskCache::build_index()
+{
+    auto directory = TRY(Core::Directory::create(m_directory, Core::Directory::CreateDirectories::Yes));
+
+    Vector<ByteString> stale_temporary_files;
+
+    TRY(directory.for_each_entry(Core::DirIterator::SkipParentAndBaseDir, [&](Core::DirectoryEntry const& entry, Core::Directory const&) -> ErrorOr<IterationDecision> {
+        if (entry.type != Core::DirectoryEntry::Type::File)
+            return IterationDecision::Continue;
+
+        // A leftover temporary file means we were interrupted while writing an entry.
+        if (entry.name.ends_with(temporary_file_suffix)) {
+            stale_temporary_files.append(entry.name);
+            return IterationDecision::Continue;
+        }
+
+        auto stat = Core::System::stat(path_for_file_name(entry.name).string());
+        if (stat.is_error())
+            return IterationDecision::Continue;
+
+        auto size = static_cast<u64>(stat.value().st_size);
+        m_index.set(entry.name, { .size = size, .last_access_time = UnixDateTime::from_seconds_since_epoch(stat.value().st_mtime) });
+        m_total_size += size;
+
+        return IterationDecision::Continue;
+    }));
+
+    for (auto const& file_name : stale_temporary_files)
+        (void)Core::System::unlink(path_for_file_name(file_name).string());
+
+    dbgln_if(HTTP_CACHE_DEBUG, "DiskCache: Loaded {} entries ({} bytes) from {}", m_index.size(), m_total_size, m_directory);
+
+    evict_entries_if_needed();
+    return {};
+}
+
+bool DiskCache::may_use_stored_response(StringView method, HTTP::HeaderMap const& request_headers)
+{
+    if (method != "GET"sv)
+        return false;
+
+    // The no-store request directive indicates that a cache MUST NOT store any part of either this request or any
+    // response to it. We don't serve stored responses to it either, as the client is clearly asking for a fresh one.
+    if (has_cache_control_directive(request_headers, "no-store"sv))
+        return false;
+
+    // If the client is asking for a partial response or for a state-changing precondition, let it talk to the origin.
+    // Conditional GETs (If-None-Match and If-Modified-Since) may still be answered from the cache.
+    for (auto header : { "Range"sv, "If-Match"sv, "If-Unmodified-Since"sv, "If-Range"sv }) {
+        if (request_headers.contains(header))
+            return false;
+    }
+
+    return true;
+}
+
+void DiskCache::open_entry(ByteString const& cache_key, Function<void(Optional<Entry>)> on_complete)
+{
+    auto file_name = file_name_for_cache_key(cache_key);
+
+    auto index_entry = m_index.get(file_name);
+    if (!index_entry.has_value()) {
+        dbgln_if(HTTP_CACHE_DEBUG, "\033[31;1mDISK CACHE MISS!\033[0m {}", cache_key);
+        on_complete({});
+        return;
+    }
+
+    index_entry->last_access_time = UnixDateTime::now();
+
+    auto operation_id = m_next_operation_id++;
+    auto path = path_for_file_name(file_name).string();
+
+    m_pending_reads.set(operation_id, { .cache_key = cache_key, .file_name = move(file_name), .on_complete = move(on_complete) });
+
+    (void)Threading::BackgroundAction<Optional<Entry>>::construct(
+        [path = move(path)](auto&) -> ErrorOr<Optional<Entry>> {
+            auto entry = read_entry(path);
+            if (entry.is_error()) {
+                dbgln("DiskCache: Unable to read {}: {}", path, entry.error());
+                return Optional<Entry> {};
+            }
+            return entry.release_value();
+        },
+        [weak_this = make_weak_ptr(), operation_id](Optional<Entry> entry) -> ErrorOr<void> {
+            if (!weak_this)
+                return {};
+
+            auto pending_read = weak_this->m_pending_reads.take(operation_id).release_value();
+
+            if (!entry.has_value()) {
+                weak_this->remove_file(pending_read.file_name);
+                pending_read.on_complete({});
+                return {};
+            }
+
+            // The presented target URI and that of the stored response must match.
+            if (entry->cache_key != pending_read.cache_key) {
+                dbgln_if(HTTP_CACHE_DEBUG, "\033[31;1mDISK CACHE MISS!\033[0m (Hash collision) {}", pending_read.cache_key);
+                pending_read.on_complete({});
+                return {};
+            }
+
+            dbgln_if(HTTP_CACHE_DEBUG, "\033[32;1mDISK CACHE HIT!\033[0m {}", pending_read.cache_key);
+            pending_read.on_complete(entry.release_value());
+            return {};
+        });
+}
+
+bool DiskCache::is_cacheable(StringView method, HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers) const
+{
+    // A cache MUST NOT store a response to a request unless:
+
+    // - the request method is understood by the cache;
+    if (method != "GET"sv)
+        return false;
+
+    // - the response status code is final (see Section 15 of [HTTP]);
+    // - if the response status code is 206 or 304, or the must-understand cache directive (see Section 5.2.2.3) is
+    //   present: the cache understands the response status code;
+    // AD-HOC: We only store complete responses with status codes that are heuristically cacheable.
+    if (status_code == 206 || !is_heuristically_cacheable_status(status_code))
+        return false;
+
+    // - the no-store cache directive is not present in the response (see Section 5.2.2.5);
+    if (has_cache_control_directive(request_headers, "no-store"sv) || has_cache_control_directive(response_headers, "no-store"sv))
+        return false;
+
+    // AD-HOC: We do not key entries on request headers, so we can only store responses that do not vary on any request
+    //         header other than Accept-Encoding (which is always the same when coming from RequestServer).
+    if (auto vary = response_headers.get("Vary"sv); vary.has_value()) {
+        bool varies_on_other_headers = false;
+
+        vary->view().for_each_split_view(',', SplitBehavior::Nothing, [&](StringView field) {
+            if (!field.trim_whitespace().equals_ignoring_ascii_case("Accept-Encoding"sv))
+                varies_on_other_headers = true;
+        });
+
+        if (varies_on_other_headers)
+            return false;
+    }
+
+    // - the response contains at least one of the following:
+    //   + a public response directive (see Section 5.2.2.9);
+    //   + a private response directive, if the cache is not shared (see Section 5.2.2.7);
+    //   + an Expires header field (see Section 5.3);
+    //   + a max-age response directive (see Section 5.2.2.1);
+    //   + a status code that is defined as heuristically cacheable (see Section 4.2.2).
+    // AD-HOC: A heuristically cacheable response is only useful to us if we can either compute a freshness lifetime for
+    //         it or revalidate it later, so we also require one of those.
+    return response_headers.contains("Expires"sv)
+        || has_cache_control_directive(response_headers, "max-age"sv)
+        || response_headers.contains("Last-Modified"sv)
+        || response_headers.contains("ETag"sv);
+}
+
+bool DiskCache::is_fresh(Entry const& entry, HTTP::HeaderMap const& request_headers)
+{
+    // https://httpwg.org/specs/rfc9111.html#cache-response-directive.no-cache
+    // The no-cache response directive indicates that the response MUST NOT be used to satisfy any other request
+    // without forwarding it for validation and receiving a successful response.
+    if (has_cache_control_directive(entry.response_headers, "no-cache"sv))
+        return false;
+
+    // https://httpwg.org/specs/rfc9111.html#cache-request-directive.no-cache
+    // The no-cache request directive indicates that the client prefers a stored response not be used to satisfy the
+    // request without successful validation on the origin server.
+    if (has_cache_control_directive(request_headers, "no-cache"sv))
+        return false;
+
+    // https://httpwg.org/specs/rfc9111.html#field.pragma
+    // When the Cache-Control header field is not present in a request, caches MUST consider the no-cache request
+    // pragma directive as having the same effect as if "Cache-Control: no-cache" were present.
+    if (!request_headers.contains("Cache-Control"sv)) {
+        if (auto pragma = request_headers.get("Pragma"sv); pragma.has_value() && pragma->view().contains("no-cache"sv, CaseSensitivity::CaseInsensitive))
+            return false;
+    }
+
+    auto age = current_age(entry);
+
+    // https://httpwg.org/specs/rfc9111.html#cache-request-directive.max-age
+    // The max-age request directive indicates that the client prefers a response whose age is less than or equal to
+    // the specified number of seconds.
+    if (auto max_age = cache_control_seconds(request_headers, "max-age"sv); max_age.has_value() && age > *max_age)
+        return false;
+
+    // https://httpwg.org/specs/rfc9111.html#expiration.model
+    // A cache can calculate if a response is fresh by comparing its freshness lifetime to its current age.
+    return freshness_lifetime(entry) > age;
+}
+
+bool DiskCache::add_conditional_request_headers(Entry const& entry, HTTP::HeaderMap& request_headers)
+{
+    bool added_validator = false;
+
+    // https://httpwg.org/specs/rfc9111.html#validation.sent
+    // When generating a conditional request for validation, a cache either starts with a request it is attempting to
+    // satisfy or -- if it is initiating the request independently -- synthesizes a request using a stored response by
+    // copying the method, target URI, and request header fields identified by the Vary header field.
+    //
+    // It then updates that request with one or more precondition header fields. These contain validator metadata
+    // sourced from a stored response(s) that has the same URI.
+
+    // One such validator is the timestamp given in a Last-Modified header field, which can be used in an
+    // If-Modified-Since header field for response validation, or in an If-Unmodified-Since or If-Range header field
+    // for representation selection.
+    if (auto last_modified = entry.response_headers.get("Last-Modified"sv); last_modified.has_value()) {
+        request_headers.set("If-Modified-Since"sv, *last_modified);
+        added_validator = true;
+    }
+
+    // Another validator is the entity tag given in an ETag field. One or more entity tags, indicating one or more
+    // stored responses, can be used in an If-None-Match header field for response validation.
+    if (auto etag = entry.response_headers.get("ETag"sv); etag.has_value()) {
+        request_headers.set("If-None-Match"sv, *etag);
+        added_validator = true;
+    }
+
+    return added_validator;
+}
+
+// https://httpwg.org/specs/rfc9111.html#validation.receiving
+bool DiskCache::is_not_modified(Entry const& entry, HTTP::HeaderMap const& request_headers)
+{
+    // A cache MUST evaluate the preconditions of a conditional request it receives once it has selected a fresh
+    // stored response, so that the client receives a 304 (Not Modified) response without contacting the origin.
+
+    // https://httpwg.org/specs/rfc9110.html#field.if-none-match
+    if (auto if_none_match = request_headers.get("If-None-Match"sv); if_none_match.has_value()) {
+        auto etag = entry.response_headers.get("ETag"sv);
+        if (!etag.has_value())
+            return false;
+
+        // A recipient MUST use the weak comparison function when comparing entity tags for If-None-Match.
+        auto opaque_tag = [](StringView tag) {
+            tag = tag.trim_whitespace();
+            if (tag.starts_with("W/"sv))
+                tag = tag.substring_view(2);
+            return tag;
+        };
+
+        bool matched = false;
+        auto stored_tag = opaque_tag(*etag);
+
+        if_none_match->view().for_each_split_view(',', SplitBehavior::Nothing, [&](StringView tag) {
+            tag = opaque_tag(tag);
+            if (tag == "*"sv || tag == stored_tag)
+                matched = true;
+        });
+
+        // A recipient MUST ignore If-Modified-Since if the request contains an If-None-Match header field.
+        return matched;
+    }
+
+    // https://httpwg.org/specs/rfc9110.html#field.if-modified-since
+    if (auto if_modified_since = parse_http_date(request_headers, "If-Modified-Since"sv); if_modified_since.has_value()) {
+        auto last_modified = parse_http_date(entry.response_headers, "Last-Modified"sv);
+        return last_modified.has_value() && *last_modified <= *if_modified_since;
+    }
+
+    return false;
+}
+
+Optional<ByteString> DiskCache::cache_key_for_request(URL::URL const& url, Optional<URL::Origin> const& top_level_origin)
+{
+    auto serialized_url = url.serialize(URL::ExcludeFragment::Yes);
+
+    // Requests made by the browser itself have no top-level origin, and share a partition of their own.
+    if (!top_level_origin.has_value())
+        return serialized_url.to_byte_string();
+
+    // An opaque origin is only ever same-site with itself, and does not survive to a later request.
+    if (top_level_origin->is_opaque())
+        return {};
+
+    // A serialized site never contains a space, so partitioned keys cannot collide with unpartitioned ones.
+    return ByteString::formatted("{} {}", URL::Site::obtain(*top_level_origin).serialize(), serialized_url);
+}
+
+void DiskCache::store_entry(Entry const& entry)
+{
+    auto contents = serialize_entry(entry);
+    if (contents.is_error()) {
+        dbgln("DiskCache: Unable to store entry for {}: {}", entry.cache_key, contents.error());
+        return;
+    }
+
+    auto file_name = file_name_for_cache_key(entry.cache_key);
+    auto size = static_cast<u64>(contents.value().size());
+
+    // The index is updated right away, so that lookups issued after this store see the new entry. Since background
+    // operations run in order, the read they queue will only run once the file has been written.
+    if (auto existing_entry = m_index.get(file_name); existing_entry.has_value())
+        m_total_size -= existing_entry->size;
+
+    m_index.set(file_name, { .size = size, .last_access_time = UnixDateTime::now() });
+    m_total_size += size;
+
+    dbgln_if(HTTP_CACHE_DEBUG, "\033[34;1mDISK CACHE STORE\033[0m {} ({} bytes)", entry.cache_key, size);
+
+    auto operation_id = m_next_operation_id++;
+    auto path = path_for_file_name(file_name).string();
+
+    // Every store writes to a temporary file of its own, so that concurrent stores for the same entry don't interleave.
+    auto temporary_path = ByteString::formatted("{}.{}{}", path, operation_id, temporary_file_suffix);
+
+    m_pending_writes.set(operation_id, move(file_name));
+
+    (void)Threading::BackgroundAction<bool>::construct(
+        [path = move(path), temporary_path = move(temporary_path), contents = contents.release_value()](auto&) -> ErrorOr<bool> {
+            if (auto result = write_file(path, temporary_path, contents); result.is_error()) {
+                dbgln("DiskCache: Unable to write {}: {}", path, result.error());
+                (void)Core::System::unlink(temporary_path);
+                return false;
+            }
+            return true;
+        },
+        [weak_this = make_weak_ptr(), operation_id](bool success) -> ErrorOr<void> {
+            if (!weak_this)
+                return {};
+
+            auto file_name = weak_this->m_pending_writes.take(operation_id).release_value();
+            if (!success)
+                weak_this->remove_file(file_name);
+            return {};
+        });
+
+    evict_entries_if_needed();
+}
+
+void DiskCache::remove_entry(StringView cache_key)
+{
+    remove_file(file_name_for_cache_key(cache_key));
+}
+
+void DiskCache::freshen_entry(Entry& entry, HTTP::HeaderMap const& not_modified_response_headers, UnixDateTime request_time, UnixDateTime response_time)
+{
+    // For each stored response identified, the cache MUST update its header fields with the header fields provided in
+    // the 304 (Not Modified) response, as per Section 3.2.
+    // https://httpwg.org/specs/rfc9111.html#update
+    HTTP::HeaderMap updated_headers;
+
+    for (auto const& header : entry.response_headers.headers()) {
+        if (!is_exempted_for_updating(header.name) && not_modified_response_headers.contains(header.name))
+            continue;
+        updated_headers.set(header.name, header.value);
+    }
+
+    for (auto const& header : not_modified_response_headers.headers()) {
+        if (is_exempted_for_updating(header.name))
+            continue;
+        updated_headers.set(header.name, header.value);
+    }
+
+    entry.response_headers = move(updated_headers);
+    entry.request_time = request_time;
+    entry.response_time = response_time;
+
+    dbgln_if(HTTP_CACHE_DEBUG, "\033[34;1mDISK CACHE REVALIDATE (304)\033[0m {}", entry.cache_key);
+    store_entry(entry);
+}
+
+void DiskCache::evict_entries_if_needed()
+{
+    if (m_total_size <= m_maximum_size)
+        return;
+
+    Vector<ByteString> file_names_by_access_time;
+    file_names_by_access_time.ensure_capacity(m_index.size());
+
+    for (auto const& it : m_index)
+        file_names_by_access_time.unchecked_append(it.key);
+
+    quick_sort(file_names_by_access_time, [&](auto const& a, auto const& b) {
+        return m_index.get(a)->last_access_time < m_index.get(b)->last_access_time;
+    });
+
+    // Evict down to a low watermark, so that we don't end up evicting an entry for every subsequent store.
+    auto target_size = m_maximum_size / 10 * 9;
+
+    for (auto const& file_name : file_names_by_access_time) {
+        if (m_total_size <= target_size)
+            break;
+
+        dbgln_if(HTTP_CACHE_DEBUG, "DiskCache: Evicting {} ({} bytes)", file_name, m_index.get(file_name)->size);
+        remove_file(file_name);
+    }
+}
+
+ByteString DiskCache::file_name_for_cache_key(StringView cache_key) const
+{
+    auto digest = Crypto::Hash::SHA1::hash(cache_key);
+    return encode_hex(digest.bytes());
+}
+
+LexicalPath DiskCache::path_for_file_name(StringView file_name) const
+{
+    return m_directory.append(file_name);
+}
+
+void DiskCache::remove_file(StringView file_name)
+{
+    if (auto index_entry = m_index.take(file_name); index_entry.has_value())
+        m_total_size -= index_entry->size;
+
+    auto path = path_for_file_name(file_name).string();
+
+    (void)Threading::BackgroundAction<Empty>::construct(
+        [path = move(path)](auto&) -> ErrorOr<Empty> {
+            if (auto result = Core::System::unlink(path); result.is_error() && result.error().code() != ENOENT)
+                dbgln("DiskCache: Unable to remove {}: {}", path, result.error());
+            return Empty {};
+        },
+        nullptr);
+}
+
+static ErrorOr<ByteString> read_string(FixedMemoryStream& stream)
+{
+    auto length = TRY(stream.read_value<LittleEndian<u32>>());
+    if (length > stream.remaining())
+        return Error::from_string_literal("Invalid string length in cache entry");
+
+    auto bytes = TRY(ByteBuffer::create_uninitialized(length));
+    TRY(stream.read_until_filled(bytes));
+    return ByteString { bytes.bytes() };
+}
+
+static ErrorOr<void> write_string(Stream& stream, StringView string)
+{
+    TRY(stream.write_value<LittleEndian<u32>>(string.length()));
+    TRY(stream.write_until_depleted(string.bytes()));
+    return {};
+}
+
+ErrorOr<DiskCache::Entry> DiskCache::read_entry(ByteString const& path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+
+    FixedMemoryStream stream { contents.bytes() };
+
+    if (TRY(stream.read_value<LittleEndian<u32>>()) != cache_entry_magic)
+        return Error::from_string_literal("Invalid cache entry magic");
+    if (TRY(stream.read_value<LittleEndian<u32>>()) != cache_entry_version)
+        return Error::from_string_literal("Unsupported cache entry version");
+
+    Entry entry;
+    entry.cache_key = TRY(read_string(stream));
+    entry.status_code = TRY(stream.read_value<LittleEndian<u32>>());
+
+    if (TRY(stream.read_value<u8>()) != 0)
+        entry.reason_phrase = TRY(String::from_byte_string(TRY(read_string(stream))));
+
+    entry.request_time = UnixDateTime::from_milliseconds_since_epoch(TRY(stream.read_value<LittleEndian<i64>>()));
+    entry.response_time = UnixDateTime::from_milliseconds_since_epoch(TRY(stream.read_value<LittleEndian<i64>>()));
+
+    auto header_count = TRY(stream.read_value<LittleEndian<u32>>());
+    for (u32 i = 0; i < header_count; ++i) {
+        auto name = TRY(read_string(stream));
+        auto value = TRY(read_string(stream));
+        entry.response_headers.set(move(name), move(value));
+    }
+
+    auto body_size = TRY(stream.read_value<LittleEndian<u64>>());
+    if (body_size != stream.remaining())
+        return Error::from_string_literal("Truncated cache entry body");
+
+    entry.body = TRY(ByteBuffer::create_uninitialized(body_size));
+    TRY(stream.read_until_filled(entry.body));
+
+    return entry;
+}
+
+ErrorOr<ByteBuffer> DiskCache::serialize_entry(Entry const& entry)
+{
+    AllocatingMemoryStream stream;
+
+    TRY(stream.write_value<LittleEndian<u32>>(cache_entry_magic));
+    TRY(stream.write_value<LittleEndian<u32>>(cache_entry_version));
+
+    TRY(write_string(stream, entry.cache_key));
+    TRY(stream.write_value<LittleEndian<u32>>(entry.status_code));
+
+    TRY(stream.write_value<u8>(entry.reason_phrase.has_value()));
+    if (entry.reason_phrase.has_value())
+        TRY(write_string(stream, entry.reason_phrase->bytes_as_string_view()));
+
+    TRY(stream.write_value<LittleEndian<i64>>(entry.request_time.milliseconds_since_epoch()));
+    TRY(stream.write_value<LittleEndian<i64>>(entry.response_time.milliseconds_since_epoch()));
+
+    Vector<HTTP::Header const&> stored_headers;
+    for (auto const& header : entry.response_headers.headers()) {
+        if (!is_exempted_for_storage(header.name) && !is_cookie_header(header.name))
+            stored_headers.append(header);
+    }
+
+    TRY(stream.write_value<LittleEndian<u32>>(stored_headers.size()));
+    for (auto const& header : stored_headers) {
+        TRY(write_string(stream, header.name));
+        TRY(write_string(stream, header.value));
+    }
+
+    TRY(stream.write_value<LittleEndian<u64>>(entry.body.size()));
+    TRY(stream.write_until_depleted(entry.body));
+
+    return stream.read_until_eof();
+}
+
+ErrorOr<void> DiskCache::write_file(ByteString const& path, ByteString const& temporary_path, ReadonlyBytes contents)
+{
+    // Write to a temporary file first, so that a crash mid-write never leaves a truncated entry in place.
+    {
+        auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+        TRY(file->write_until_depleted(contents));
+    }
+
+    TRY(Core::System::rename(temporary_path, path));
+    return {};
+}
+
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/LexicalPath.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Weakable.h>
+#include <LibHTTP/HeaderMap.h>
+#include <LibURL/Origin.h>
+#include <LibURL/URL.h>
+
+namespace RequestServer {
+
+// A persistent, size-bounded HTTP cache shared by every client of this RequestServer process.
+// https://httpwg.org/specs/rfc9111.html
+//
+// Each stored response lives in its own file inside the cache directory, named after a hash of its cache key. An
+// in-memory index of those files is rebuilt from the directory contents on startup, and is used to evict the least
+// recently used entries once the total size of the cache exceeds its limit.
+//
+// All file I/O after startup happens on the background thread, so that large entries never block the event loop.
+// Operations are queued in the order they were issued, so e.g. a read that follows a store observes the stored entry.
+// Operations that complete after the cache has been destroyed are dropped, and their callbacks are never invoked.
+class DiskCache : public Weakable<DiskCache> {
+public:
+    static constexpr u64 default_maximum_size = 256 * MiB;
+
+    static ErrorOr<NonnullOwnPtr<DiskCache>> create(LexicalPath directory, u64 maximum_size = default_maximum_size);
+
+    // Stored responses are keyed by the site of the top-level document that requested them, and by their URL without
+    // its fragment. Partitioning by site prevents one site from learning which resources another site has loaded.
+    // Returns an empty Optional if responses for the request must not be cached, i.e. if its top-level origin is opaque.
+    static Optional<ByteString> cache_key_for_request(URL::URL const&, Optional<URL::Origin> const& top_level_origin);
+
+    struct Entry {
+        ByteString cache_key;
+        u32 status_code { 0 };
+        Optional<String> reason_phrase;
+        HTTP::HeaderMap response_headers;
+        UnixDateTime request_time;
+        UnixDateTime response_time;
+        ByteBuffer body;
+    };
+
+    // https://httpwg.org/specs/rfc9111.html#constructing.responses.from.caches
+    static bool may_use_stored_response(StringView method, HTTP::HeaderMap const& request_headers);
+
+    // Invokes the callback on the current event loop once the entry has been read from disk, or immediately if there is
+    // no stored response for the cache key.
+    void open_entry(ByteString const& cache_key, Function<void(Optional<Entry>)> on_complete);
+
+    // https://httpwg.org/specs/rfc9111.html#response.cacheability
+    bool is_cacheable(StringView method, HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers) const;
+
+    void store_entry(Entry const&);
+    void remove_entry(StringView cache_key);
+
+    // https://httpwg.org/specs/rfc9111.html#freshening.responses
+    void freshen_entry(Entry&, HTTP::HeaderMap const& not_modified_response_headers, UnixDateTime request_time, UnixDateTime response_time);
+
+    u64 maximum_entry_size() const { return m_maximum_size / 8; }
+
+    // https://httpwg.org/specs/rfc9111.html#expiration.model
+    static bool is_fresh(Entry const&, HTTP::HeaderMap const& request_headers);
+
+    // https://httpwg.org/specs/rfc9111.html#validation.sent
+    static bool add_conditional_request_headers(Entry const&, HTTP::HeaderMap& request_headers);
+
+    // https://httpwg.org/specs/rfc9111.html#validation.receiving
+    static bool is_not_modified(Entry const&, HTTP::HeaderMap const& request_headers);
+
+private:
+    DiskCache(LexicalPath directory, u64 maximum_size);
+
+    ErrorOr<void> build_index();
+    void evict_entries_if_needed();
+
+    ByteString file_name_for_cache_key(StringView cache_key) const;
+    LexicalPath path_for_file_name(StringView file_name) const;
+
+    void remove_file(StringView file_name);
+
+    // These run on the background thread.
+    static ErrorOr<Entry> read_entry(ByteString const& path);
+    static ErrorOr<void> write_file(ByteString const& path, ByteString const& temporary_path, ReadonlyBytes contents);
+
+    static ErrorOr<ByteBuffer> serialize_entry(Entry const&);
+
+    struct IndexEntry {
+        u64 size { 0 };
+        UnixDateTime last_access_time;
+    };
+
+    LexicalPath m_directory;
+    u64 m_maximum_size { 0 };
+    u64 m_total_size { 0 };
+    HashMap<ByteString, IndexEntry> m_index;
+
+    // Background operations only capture data they own exclusively. Everything else they need once they complete is
+    // kept here, keyed by operation ID.
+    struct PendingRead {
+        ByteString cache_key;
+        ByteString file_name;
+        Function<void(Optional<Entry>)> on_complete;
+    };
+    u64 m_next_operation_id { 0 };
+    HashMap<u64, PendingRead> m_pending_reads;
+    HashMap<u64, ByteString> m_pending_writes;
+};
+
+}
@@ -12,6 +12,7 @@
 #include <LibCore/ArgsParser.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Process.h>
+#include <LibCore/StandardPaths.h>
 #include <LibIPC/SingleServer.h>
 #include <LibMain/Main.h>
 #include <RequestServer/ConnectionFromClient.h>
@@ -33,11 +34,13 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     Vector<ByteString> certificates;
     StringView mach_server_name;
     bool wait_for_debugger = false;
+    bool enable_http_disk_cache = false;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
+    args_parser.add_option(enable_http_disk_cache, "Enable the persistent HTTP disk cache", "enable-http-disk-cache");
     args_parser.parse(arguments);
 
     if (wait_for_debugger)
@@ -47,6 +50,15 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     if (!certificates.is_empty())
         RequestServer::g_default_certificate_path = certificates.first();
 
+    if (enable_http_disk_cache) {
+        auto cache_directory = LexicalPath::join(Core::StandardPaths::cache_directory(), "Ladybird"sv, "HTTPCache"sv);
+
+        if (auto disk_cache = RequestServer::DiskCache::create(move(cache_directory)); disk_cache.is_error())
+            warnln("Unable to create HTTP disk cache: {}", disk_cache.error());
+        else
+            RequestServer::g_disk_cache = disk_cache.release_value();
+    }
+
     Core::EventLoop event_loop;
 
 #if defined(AK_OS_MACOS)
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Utf16String.h>
+#include <LibCore/MappedFile.h>
+#include <LibGfx/Font/Font.h>
+#include <LibGfx/Font/Typeface.h>
+#include <LibGfx/TextLayout.h>
+#include <LibTest/TestCase.h>
+
+#define TEST_INPUT(x) ("test-inputs/" x)
+
+using ShapingCache = Gfx::Font::ShapingCache;
+
+// NOTE: The memory budget is shared by the caches of all fonts, so every test uses a font of its own size to start out
+//       with an empty cache, and makes sure that entries left behind by other tests don't change its outcome.
+static NonnullRefPtr<Gfx::Font> load_font(float point_size)
+{
+    auto file = MUST(Core::MappedFile::map(TEST_INPUT("ttf/Ahem.ttf"sv)));
+    auto typeface = MUST(Gfx::Typeface::try_load_from_temporary_memory(file->bytes()));
+    return typeface->font(point_size);
+}
+
+static void shape(Gfx::Font const& font, Utf16String const& text, Gfx::ShapeFeatures const& features = {})
+{
+    (void)Gfx::shape_text({}, 0, text.utf16_view(), font, Gfx::GlyphRun::TextType::Ltr, features);
+}
+
+// NOTE: Looking an entry up marks it as recently used.
+static bool is_cached(Gfx::Font const& font, Utf16String const& text, Gfx::ShapeFeatures const& features = {})
+{
+    return font.shaping_cache().get(text.utf16_view(), features) != nullptr;
+}
+
+// Every filler text is as long as a cacheable text can be, so it takes up as much of the budget as one entry can.
+static Utf16String filler_text(size_t index)
+{
+    auto text = Utf16String::formatted("{:064}", index);
+    VERIFY(text.length_in_code_units() == ShapingCache::maximum_cacheable_length_in_code_units);
+    return text;
+}
+
+// Each filler entry holds a glyph per code unit, and HarfBuzz keeps well over 16 bytes of info and position data per
+// glyph, so this many of them are more than enough to exceed the budget.
+static constexpr size_t filler_count = ShapingCache::maximum_total_size_in_bytes / (ShapingCache::maximum_cacheable_length_in_code_units * 16);
+
+TEST_CASE(entries_are_evicted_once_the_budget_is_exceeded)
+{
+    auto font = load_font(11);
+
+    auto first_text = "first entry"_utf16;
+    shape(*font, first_text);
+
+    for (size_t i = 0; i < filler_count; ++i)
+        shape(*font, filler_text(i));
+
+    EXPECT(!is_cached(*font, first_text));
+    EXPECT(is_cached(*font, filler_text(filler_count - 1)));
+}
+
+TEST_CASE(hits_mark_entries_as_recently_used)
+{
+    auto font = load_font(12);
+
+    auto used_text = "used entry"_utf16;
+    auto unused_text = "unused entry"_utf16;
+    shape(*font, used_text);
+    shape(*font, unused_text);
+
+    for (size_t i = 0; i < filler_count; ++i) {
+        shape(*font, filler_text(i));
+        shape(*font, used_text);
+    }
+
+    EXPECT(is_cached(*font, used_text));
+    EXPECT(!is_cached(*font, unused_text));
+}
+
+TEST_CASE(entries_are_keyed_by_features)
+{
+    auto font = load_font(13);
+
+    auto text = "office"_utf16;
+    Gfx::ShapeFeatures no_ligatures { { .tag = { 'l', 'i', 'g', 'a' }, .value = 0 } };
+    Gfx::ShapeFeatures no_kerning { { .tag = { 'k', 'e', 'r', 'n' }, .value = 0 } };
+
+    shape(*font, text);
+    shape(*font, text, no_ligatures);
+
+    auto* default_buffer = font->shaping_cache().get(text.utf16_view(), {});
+    auto* no_ligatures_buffer = font->shaping_cache().get(text.utf16_view(), no_ligatures);
+    EXPECT(default_buffer);
+    EXPECT(no_ligatures_buffer);
+    EXPECT_NE(default_buffer, no_ligatures_buffer);
+
+    EXPECT(!is_cached(*font, text, no_kerning));
+}
+
+TEST_CASE(long_texts_are_not_cached)
+{
+    auto font = load_font(14);
+
+    auto longest_cacheable_text = filler_text(0);
+    shape(*font, longest_cacheable_text);
+    EXPECT(is_cached(*font, longest_cacheable_text));
+
+    auto too_long_text = Utf16String::formatted("{}x", longest_cacheable_text);
+    shape(*font, too_long_text);
+    EXPECT(!is_cached(*font, too_long_text));
+}
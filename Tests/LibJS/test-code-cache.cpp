@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/CodeCache.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+// Scripts smaller than 1 KiB aren't cached, so pad the source with a comment.
+static ByteString make_source(StringView statement)
+{
+    StringBuilder builder;
+    builder.append(statement);
+    builder.append("\n// "sv);
+    builder.append_repeated('x', 1 * KiB);
+    return builder.to_byte_string();
+}
+
+// NOTE: The parse trees are kept alive here, so that one that was freed can't be mistaken for another that happens to
+//       be allocated at the same address.
+static NonnullRefPtr<JS::Program const> parse_script(JS::Realm& realm, StringView source_text, StringView filename)
+{
+    auto script = MUST(JS::Script::parse(source_text, realm, filename));
+    return script->parse_node();
+}
+
+TEST_CASE(nothing_is_cached_without_a_budget)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto source = make_source("var a = 1;"sv);
+    auto first = parse_script(realm, source, "https://example.com/a.js"sv);
+    EXPECT_NE(parse_script(realm, source, "https://example.com/a.js"sv).ptr(), first.ptr());
+}
+
+TEST_CASE(same_source_text_is_parsed_once)
+{
+    auto vm = JS::VM::create();
+    vm->code_cache().set_maximum_source_size_in_bytes(1 * MiB);
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto source = make_source("var a = 1;"sv);
+    auto first = parse_script(realm, source, "https://example.com/a.js"sv);
+    EXPECT_EQ(parse_script(realm, source, "https://example.com/a.js"sv).ptr(), first.ptr());
+
+    // The same text loaded from another URL is a different script.
+    EXPECT_NE(parse_script(realm, source, "https://example.com/b.js"sv).ptr(), first.ptr());
+}
+
+TEST_CASE(changed_source_text_at_the_same_url_is_parsed_again)
+{
+    auto vm = JS::VM::create();
+    vm->code_cache().set_maximum_source_size_in_bytes(1 * MiB);
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto original_source = make_source("var a = 1;"sv);
+    auto changed_source = make_source("var a = 2;"sv);
+    auto original = parse_script(realm, original_source, "https://example.com/a.js"sv);
+    auto changed = parse_script(realm, changed_source, "https://example.com/a.js"sv);
+    EXPECT_NE(changed.ptr(), original.ptr());
+    EXPECT(changed->source_code().code().utf16_view() == changed_source.view());
+
+    EXPECT_EQ(parse_script(realm, original_source, "https://example.com/a.js"sv).ptr(), original.ptr());
+    EXPECT_EQ(parse_script(realm, changed_source, "https://example.com/a.js"sv).ptr(), changed.ptr());
+}
+
+TEST_CASE(scripts_are_only_shared_within_a_partition)
+{
+    auto vm = JS::VM::create();
+    vm->code_cache().set_maximum_source_size_in_bytes(1 * MiB);
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    Optional<String> partition = "https://example.com"_string;
+    vm->host_get_code_cache_partition = [&](JS::Realm&) { return partition; };
+
+    auto source = make_source("var a = 1;"sv);
+    auto first = parse_script(realm, source, "https://example.com/a.js"sv);
+    EXPECT_EQ(parse_script(realm, source, "https://example.com/a.js"sv).ptr(), first.ptr());
+
+    partition = "https://example.org"_string;
+    EXPECT_NE(parse_script(realm, source, "https://example.com/a.js"sv).ptr(), first.ptr());
+
+    // Realms without a partition don't use the cache at all.
+    partition = {};
+    auto uncached = parse_script(realm, source, "https://example.com/a.js"sv);
+    EXPECT_NE(uncached.ptr(), first.ptr());
+    EXPECT_NE(parse_script(realm, source, "https://example.com/a.js"sv).ptr(), uncached.ptr());
+}
+
+TEST_CASE(cached_bytecode_does_not_mix_up_lexical_globals_of_different_realms)
+{
+    auto vm = JS::VM::create();
+    vm->code_cache().set_maximum_source_size_in_bytes(1 * MiB);
+    auto first_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto second_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& first_realm = *first_execution_context->realm;
+    auto& second_realm = *second_execution_context->realm;
+
+    auto run = [&](JS::Realm& realm, StringView source_text, StringView filename) {
+        auto script = MUST(JS::Script::parse(source_text, realm, filename));
+        return MUST(vm->bytecode_interpreter().run(*script)).as_double();
+    };
+
+    // Both global declarative environments end up with two bindings, but in a different order.
+    run(first_realm, "let a = 1; let b = 2;"sv, "https://example.com/first.js"sv);
+    run(second_realm, "let b = 4; let a = 3;"sv, "https://example.com/second.js"sv);
+
+    auto source = make_source("function bumpA() { a += 100; return a; } bumpA();"sv);
+    EXPECT_EQ(run(first_realm, source, "https://example.com/shared.js"sv), 101);
+    EXPECT_EQ(run(first_realm, source, "https://example.com/shared.js"sv), 201);
+
+    // This reuses the parse tree, and with it the bytecode of bumpA() and its global variable caches.
+    EXPECT_EQ(run(second_realm, source, "https://example.com/shared.js"sv), 103);
+    EXPECT_EQ(run(second_realm, "b"sv, "https://example.com/read-b.js"sv), 4);
+    EXPECT_EQ(run(first_realm, "b"sv, "https://example.com/read-b.js"sv), 2);
+}
@@ -1379,3 +1379,163 @@ TEST_CASE(account_for_opcode_size_calculating_incoming_jump_edges)
         EXPECT_EQ(result.matches.first().view.to_byte_string(), "aa"sv);
     }
 }
+
+TEST_CASE(pure_substring_search)
+{
+    {
+        Regex<ECMA262> re("abc", ECMAScriptFlags::Global);
+        EXPECT(re.parser_result.optimization_data.pure_substring_search.has_value());
+
+        auto result = re.match("xxabcxabxabcab"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].column, 2u);
+        EXPECT_EQ(result.matches[1].column, 9u);
+    }
+    {
+        // Occurrences must also be found in UTF-16 subjects, including ones containing non-ASCII code units.
+        Regex<ECMA262> re("ab", ECMAScriptFlags::Global);
+
+        auto subject = Utf16String::from_utf8("😀aab😀a"sv);
+        auto result = re.match(Utf16View { subject });
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 1u);
+        EXPECT_EQ(result.matches.first().column, 3u);
+    }
+    {
+        // Sticky patterns must not skip ahead to a later occurrence.
+        Regex<ECMA262> re("abc", ECMAScriptFlags::Sticky);
+        EXPECT_EQ(re.match("xabc"sv).success, false);
+        EXPECT_EQ(re.match("abcx"sv).success, true);
+    }
+}
+
+TEST_CASE(starting_ascii_characters_scan)
+{
+    {
+        Regex<ECMA262> re("[xy]\\d+", ECMAScriptFlags::Global);
+        EXPECT_EQ(re.parser_result.optimization_data.starting_ascii_characters.size(), 2u);
+
+        // Long enough that candidates are found both within full vectors and in the scalar tail.
+        auto result = re.match("..................x1...........................y23..x"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].view.to_byte_string(), "x1"sv);
+        EXPECT_EQ(result.matches[1].view.to_byte_string(), "y23"sv);
+    }
+    {
+        Regex<ECMA262> re("q[a-z]", ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive);
+
+        auto subject = Utf16String::from_utf8("😀😀😀😀😀😀😀😀😀😀 Qu qa"sv);
+        auto result = re.match(Utf16View { subject });
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].view.to_byte_string(), "Qu"sv);
+    }
+}
+
+TEST_CASE(starting_ascii_characters_pattern_shapes)
+{
+    auto starting_ascii_characters = [](StringView pattern, ECMAScriptFlags flags = {}) {
+        Regex<ECMA262> re(pattern, flags);
+        return re.parser_result.optimization_data.starting_ascii_characters.size();
+    };
+
+    auto starting_ascii_characters_insensitive = [](StringView pattern) {
+        Regex<ECMA262> re(pattern, ECMAScriptFlags::Insensitive);
+        return re.parser_result.optimization_data.starting_ascii_characters_insensitive.size();
+    };
+
+    // A single leading character, also when it's inside a capture group.
+    EXPECT_EQ(starting_ascii_characters("x\\d"sv), 1u);
+    EXPECT_EQ(starting_ascii_characters("(x)\\d"sv), 1u);
+    EXPECT_EQ(starting_ascii_characters("(?:x)\\d"sv), 1u);
+
+    // Classes and ranges are expanded, up to eight characters.
+    EXPECT_EQ(starting_ascii_characters("[xy]\\d"sv), 2u);
+    EXPECT_EQ(starting_ascii_characters("[a-h]z"sv), 8u);
+    EXPECT_EQ(starting_ascii_characters("[a-i]z"sv), 0u);
+    EXPECT_EQ(starting_ascii_characters("[a-ey-z_]z"sv), 8u);
+
+    // Case-insensitive patterns scan for both cases, so they can only afford half as many letters.
+    EXPECT_EQ(starting_ascii_characters_insensitive("[xy]\\d"sv), 4u);
+    EXPECT_EQ(starting_ascii_characters_insensitive("[_1]\\d"sv), 2u);
+    EXPECT_EQ(starting_ascii_characters_insensitive("[a-h]z"sv), 0u);
+
+    // Non-ASCII, negated and class-escape starts are left to the starting ranges (or to no optimization at all).
+    EXPECT_EQ(starting_ascii_characters("[x\\u00e9]\\d"sv), 0u);
+    EXPECT_EQ(starting_ascii_characters("[^x]\\d"sv), 0u);
+    EXPECT_EQ(starting_ascii_characters("\\w\\d"sv), 0u);
+    EXPECT_EQ(starting_ascii_characters("^x\\d"sv, ECMAScriptFlags::Multiline), 0u);
+}
+
+TEST_CASE(starting_ascii_characters_scan_edge_cases)
+{
+    {
+        // Candidates that don't lead to a match, wherever they are, must not produce one.
+        Regex<ECMA262> re("[xy]\\d"sv, ECMAScriptFlags::Global);
+        EXPECT_EQ(re.match(""sv).success, false);
+        EXPECT_EQ(re.match("x"sv).success, false);
+        EXPECT_EQ(re.match("................................"sv).success, false);
+        EXPECT_EQ(re.match("x.y.x.y.x.y.x.y.x.y.x.y.x.y.x.y.x"sv).success, false);
+        EXPECT_EQ(re.match("X1Y2X1Y2X1Y2X1Y2X1Y2"sv).success, false);
+    }
+    {
+        // Matches right at the start, on both sides of a vector boundary, and at the very end.
+        Regex<ECMA262> re("[xy]\\d"sv, ECMAScriptFlags::Global);
+        auto result = re.match("x1.............y2x3..............y4"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 4u);
+        EXPECT_EQ(result.matches[0].column, 0u);
+        EXPECT_EQ(result.matches[1].column, 15u);
+        EXPECT_EQ(result.matches[2].column, 17u);
+        EXPECT_EQ(result.matches[3].column, 33u);
+    }
+    {
+        // UTF-16 code units whose low byte is an ASCII starting character must not be taken for it.
+        Regex<ECMA262> re("[xy]\\d"sv, ECMAScriptFlags::Global);
+
+        auto subject = Utf16String::from_utf8("Ÿ1Ź1硸1祹1 ŸŸŸŸŸŸŸŸŸ1"sv);
+        EXPECT_EQ(re.match(Utf16View { subject }).success, false);
+
+        auto subject_with_match = Utf16String::from_utf8("ŸŹ硸祹ŸŹ硸祹Ÿy2"sv);
+        auto result = re.match(Utf16View { subject_with_match });
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 1u);
+        EXPECT_EQ(result.matches.first().column, 9u);
+    }
+    {
+        // Without the insensitive flag, the other case is not a candidate; with it, both are.
+        Regex<ECMA262> sensitive("q[a-z]"sv, ECMAScriptFlags::Global);
+        EXPECT_EQ(sensitive.match("QU QA Qz"sv).success, false);
+
+        Regex<ECMA262> insensitive("q[a-z]"sv, ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive);
+        auto result = insensitive.match("QU qa Qz"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 3u);
+    }
+    {
+        // Case-insensitive patterns with too many letters to scan for still match through the starting ranges.
+        Regex<ECMA262> re("[a-h]z"sv, ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive);
+        auto result = re.match("..............................Hz..az..iz"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].view.to_byte_string(), "Hz"sv);
+        EXPECT_EQ(result.matches[1].view.to_byte_string(), "az"sv);
+    }
+    {
+        // Sticky patterns must not skip ahead to a later candidate.
+        Regex<ECMA262> re("[xy]\\d"sv, ECMAScriptFlags::Sticky);
+        EXPECT_EQ(re.match(".x1"sv).success, false);
+        EXPECT_EQ(re.match("y1."sv).success, true);
+    }
+    {
+        // Overlapping candidates: the scan resumes right after a failed attempt, not after the next vector.
+        Regex<ECMA262> re("x+y"sv, ECMAScriptFlags::Global);
+        auto result = re.match("xxxxxxxxxxxxxxxxxxxxxxy"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 1u);
+        EXPECT_EQ(result.matches.first().column, 0u);
+        EXPECT_EQ(result.matches.first().view.to_byte_string(), "xxxxxxxxxxxxxxxxxxxxxxy"sv);
+    }
+}
@@ -18,6 +18,8 @@ Description:
 
 Endpoints:
     - POST /echo <json body>, Creates an echo response for later use. See "Echo" class below for body properties.
+    - POST /echo/request-count <json body>, Returns how many times the echo with the given "method" and "path" has been
+      requested so far, as {"count": <count>}.
 """
 
 
@@ -30,6 +32,7 @@ class Echo:
     delay_ms: Optional[int]
     reason_phrase: Optional[str]
     reflect_headers_in_body: bool
+    request_count: int = 0
 
 
 # In-memory store for echo responses
@@ -104,6 +107,21 @@ class TestHTTPRequestHandler(http.server.SimpleHTTPRequestHandler):
             self.send_header("Content-Type", "application/json")
             self.end_headers()
             self.wfile.write(json.dumps(fetch_config).encode("utf-8"))
+        elif self.path == "/echo/request-count":
+            content_length = int(self.headers["Content-Length"])
+            post_data = self.rfile.read(content_length)
+            data = json.loads(post_data.decode("utf-8"))
+
+            key = f"{data.get('method', None)} {data.get('path', None)}"
+            if key not in echo_store:
+                self.send_error(404, f"Echo response not found for {key}")
+                return
+
+            self.send_response(200)
+            self.send_header("Access-Control-Allow-Origin", "*")
+            self.send_header("Content-Type", "application/json")
+            self.end_headers()
+            self.wfile.write(json.dumps({"count": echo_store[key].request_count}).encode("utf-8"))
         elif self.path.startswith("/static/"):
             self.send_error(405, "Method Not Allowed")
         else:
@@ -134,6 +152,7 @@ class TestHTTPRequestHandler(http.server.SimpleHTTPRequestHandler):
 
         if key in echo_store:
             echo = echo_store[key]
+            echo.request_count += 1
 
             if echo.delay_ms is not None:
                 time.sleep(echo.delay_ms / 1000)
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <LibGfx/Matrix4x4.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListDamage.h>
+#include <LibWeb/Painting/DisplayListRecorder.h>
+
+using namespace Web::Painting;
+
+template<typename Callback>
+static NonnullRefPtr<DisplayList> record(Callback callback)
+{
+    auto display_list = DisplayList::create(1);
+    {
+        DisplayListRecorder recorder(*display_list);
+        callback(recorder);
+    }
+    return display_list;
+}
+
+static Optional<Vector<Gfx::IntRect>> damage_between(DisplayList& old_display_list, DisplayList& new_display_list)
+{
+    return compute_display_list_damage(old_display_list, {}, new_display_list, {});
+}
+
+static void push_translated_stacking_context(DisplayListRecorder& recorder, float x)
+{
+    recorder.push_stacking_context({
+        .opacity = 1,
+        .compositing_and_blending_operator = Gfx::CompositingAndBlendingOperator::Normal,
+        .isolate = false,
+        .transform = StackingContextTransform({}, Gfx::translation_matrix(Gfx::FloatVector3 { x, 0, 0 }), 1),
+    });
+}
+
+TEST_CASE(identical_display_lists_have_no_damage)
+{
+    auto paint = [](DisplayListRecorder& recorder) {
+        recorder.fill_rect({ 0, 0, 100, 100 }, Color::Red);
+        recorder.fill_rect({ 200, 200, 10, 10 }, Color::Blue);
+    };
+    auto old_display_list = record(paint);
+    auto new_display_list = record(paint);
+
+    auto damage = damage_between(old_display_list, new_display_list);
+    EXPECT(damage.has_value());
+    EXPECT(damage->is_empty());
+}
+
+TEST_CASE(changed_command_damages_its_bounds)
+{
+    auto old_display_list = record([](DisplayListRecorder& recorder) {
+        recorder.fill_rect({ 0, 0, 100, 100 }, Color::Red);
+        recorder.fill_rect({ 200, 200, 10, 10 }, Color::Blue);
+    });
+    auto new_display_list = record([](DisplayListRecorder& recorder) {
+        recorder.fill_rect({ 0, 0, 100, 100 }, Color::Red);
+        recorder.fill_rect({ 200, 200, 10, 10 }, Color::Green);
+    });
+
+    auto damage = damage_between(old_display_list, new_display_list);
+    EXPECT(damage.has_value());
+    EXPECT(!damage->is_empty());
+    for (auto const& rect : *damage) {
+        EXPECT(rect.contains(Gfx::IntRect { 200, 200, 10, 10 }));
+        EXPECT(!rect.intersects(Gfx::IntRect { 0, 0, 100, 100 }));
+    }
+}
+
+TEST_CASE(structural_change_damages_enclosing_stacking_context)
+{
+    auto old_display_list = record([](DisplayListRecorder& recorder) {
+        recorder.fill_rect({ 0, 0, 100, 100 }, Color::Red);
+        push_translated_stacking_context(recorder, 0);
+        recorder.fill_rect({ 200, 200, 10, 10 }, Color::Blue);
+        recorder.pop_stacking_context();
+    });
+    auto new_display_list = record([](DisplayListRecorder& recorder) {
+        recorder.fill_rect({ 0, 0, 100, 100 }, Color::Red);
+        push_translated_stacking_context(recorder, 0);
+        recorder.fill_rect({ 200, 200, 10, 10 }, Color::Blue);
+        recorder.fill_rect({ 220, 200, 10, 10 }, Color::Blue);
+        recorder.pop_stacking_context();
+    });
+
+    auto damage = damage_between(old_display_list, new_display_list);
+    EXPECT(damage.has_value());
+    Gfx::IntRect damaged_area;
+    for (auto const& rect : *damage)
+        damaged_area.unite(rect);
+    EXPECT(damaged_area.contains(Gfx::IntRect { 200, 200, 30, 10 }));
+    EXPECT(!damaged_area.intersects(Gfx::IntRect { 0, 0, 100, 100 }));
+}
+
+TEST_CASE(moved_stacking_context_damages_old_and_new_position)
+{
+    auto paint = [](float x) {
+        return [x](DisplayListRecorder& recorder) {
+            recorder.fill_rect({ 0, 0, 100, 100 }, Color::Red);
+            push_translated_stacking_context(recorder, x);
+            recorder.fill_rect({ 200, 200, 10, 10 }, Color::Blue);
+            recorder.pop_stacking_context();
+        };
+    };
+    auto old_display_list = record(paint(0));
+    auto new_display_list = record(paint(50));
+
+    auto damage = damage_between(old_display_list, new_display_list);
+    EXPECT(damage.has_value());
+    Gfx::IntRect damaged_area;
+    for (auto const& rect : *damage)
+        damaged_area.unite(rect);
+    EXPECT(damaged_area.contains(Gfx::IntRect { 200, 200, 10, 10 }));
+    EXPECT(damaged_area.contains(Gfx::IntRect { 250, 200, 10, 10 }));
+    EXPECT(!damaged_area.intersects(Gfx::IntRect { 0, 0, 100, 100 }));
+}
+
+TEST_CASE(top_level_structural_change_damages_everything)
+{
+    auto old_display_list = record([](DisplayListRecorder& recorder) {
+        recorder.fill_rect({ 0, 0, 100, 100 }, Color::Red);
+    });
+    auto new_display_list = record([](DisplayListRecorder& recorder) {
+        recorder.fill_rect({ 0, 0, 100, 100 }, Color::Red);
+        recorder.fill_rect({ 200, 200, 10, 10 }, Color::Blue);
+    });
+
+    EXPECT(!damage_between(old_display_list, new_display_list).has_value());
+}
@@ -186,6 +186,29 @@ TEST_CASE(multiple_attributes)
     END_ENUMERATION();
 }
 
+TEST_CASE(long_quoted_attributes)
+{
+    auto tokens = run_tokenizer("<p foo=\"abcdefghijklmnopqrstuvwxyz\" bar='0123456789&amp;0123456789'>"sv);
+    BEGIN_ENUMERATION(tokens);
+    EXPECT_START_TAG_TOKEN(p, 1u, 67u);
+    EXPECT_TAG_TOKEN_ATTRIBUTE_COUNT(2);
+    EXPECT_TAG_TOKEN_ATTRIBUTE(foo, "abcdefghijklmnopqrstuvwxyz", 3u, 6u, 7u, 35u);
+    EXPECT_TAG_TOKEN_ATTRIBUTE(bar, "0123456789&0123456789", 36u, 39u, 40u, 67u);
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
+TEST_CASE(newlines_in_quoted_attribute)
+{
+    auto tokens = run_tokenizer("<p foo=\"abc\r\ndef\">"sv);
+    BEGIN_ENUMERATION(tokens);
+    EXPECT_START_TAG_TOKEN(p, 1u, 4u);
+    EXPECT_TAG_TOKEN_ATTRIBUTE_COUNT(1);
+    EXPECT_TAG_TOKEN_ATTRIBUTE(foo, "abc\ndef", 3u, 6u, 7u, 4u);
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
 TEST_CASE(character_reference_in_attribute)
 {
     auto tokens = run_tokenizer("<p foo=a&amp;b bar='a&#38;b' baz=\"a&#x26;b\">"sv);
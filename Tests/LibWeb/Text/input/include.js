@@ -119,6 +119,19 @@ class HTTPTestServer {
         }
         return `${this.baseURL}${path}`;
     }
+    async getRequestCount(method, path) {
+        const result = await fetch(`${this.baseURL}/echo/request-count`, {
+            method: "POST",
+            headers: {
+                "Content-Type": "application/json",
+            },
+            body: JSON.stringify({ method, path }),
+        });
+        if (!result.ok) {
+            throw new Error("Error getting request count: " + result.statusText);
+        }
+        return (await result.json()).count;
+    }
     getStaticURL(path) {
         return `${this.baseURL}/static/${path}`;
     }
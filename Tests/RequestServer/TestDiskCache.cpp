@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/Directory.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibFileSystem/TempFile.h>
+#include <LibTest/TestCase.h>
+#include <LibURL/Parser.h>
+#include <RequestServer/DiskCache.h>
+
+using RequestServer::DiskCache;
+
+static NonnullOwnPtr<DiskCache> create_disk_cache(FileSystem::TempFile const& directory)
+{
+    return MUST(DiskCache::create(LexicalPath { directory.path().to_byte_string() }));
+}
+
+static ByteString cache_key(StringView url, Optional<StringView> top_level_url = {})
+{
+    Optional<URL::Origin> top_level_origin;
+    if (top_level_url.has_value())
+        top_level_origin = URL::Parser::basic_parse(*top_level_url)->origin();
+
+    return DiskCache::cache_key_for_request(*URL::Parser::basic_parse(url), top_level_origin).release_value();
+}
+
+static DiskCache::Entry create_entry(ByteString cache_key, HTTP::HeaderMap response_headers, StringView body)
+{
+    auto now = UnixDateTime::now();
+
+    return {
+        .cache_key = move(cache_key),
+        .status_code = 200,
+        .reason_phrase = "OK"_string,
+        .response_headers = move(response_headers),
+        .request_time = now,
+        .response_time = now,
+        .body = MUST(ByteBuffer::copy(body.bytes())),
+    };
+}
+
+static Optional<DiskCache::Entry> open_entry(DiskCache& disk_cache, ByteString const& cache_key)
+{
+    Optional<Optional<DiskCache::Entry>> result;
+
+    disk_cache.open_entry(cache_key, [&](Optional<DiskCache::Entry> entry) {
+        result = move(entry);
+    });
+
+    Core::EventLoop::current().spin_until([&] { return result.has_value(); });
+    return result.release_value();
+}
+
+TEST_CASE(miss)
+{
+    Core::EventLoop event_loop;
+
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    auto disk_cache = create_disk_cache(*directory);
+
+    EXPECT(!open_entry(*disk_cache, cache_key("https://example.com/script.js"sv)).has_value());
+}
+
+TEST_CASE(hit)
+{
+    Core::EventLoop event_loop;
+
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    auto disk_cache = create_disk_cache(*directory);
+
+    auto key = cache_key("https://example.com/script.js#fragment"sv);
+
+    HTTP::HeaderMap response_headers;
+    response_headers.set("Cache-Control"sv, "max-age=3600"sv);
+    response_headers.set("Transfer-Encoding"sv, "chunked"sv);
+    disk_cache->store_entry(create_entry(key, response_headers, "well hello friends"sv));
+
+    auto entry = open_entry(*disk_cache, cache_key("https://example.com/script.js"sv));
+    VERIFY(entry.has_value());
+
+    EXPECT_EQ(entry->cache_key, key);
+    EXPECT_EQ(entry->status_code, 200u);
+    EXPECT_EQ(entry->reason_phrase.value(), "OK"sv);
+    EXPECT_EQ(entry->response_headers.get("Cache-Control"sv).value(), "max-age=3600"sv);
+    EXPECT(!entry->response_headers.contains("Transfer-Encoding"sv));
+    EXPECT_EQ(StringView { entry->body.bytes() }, "well hello friends"sv);
+
+    EXPECT(DiskCache::is_fresh(*entry, {}));
+
+    // The query string is part of the cache key.
+    EXPECT(!open_entry(*disk_cache, cache_key("https://example.com/script.js?v=2"sv)).has_value());
+}
+
+TEST_CASE(cookies_are_not_replayed_from_the_cache)
+{
+    Core::EventLoop event_loop;
+
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    auto disk_cache = create_disk_cache(*directory);
+
+    auto key = cache_key("https://example.com/account"sv);
+
+    HTTP::HeaderMap response_headers;
+    response_headers.set("Cache-Control"sv, "max-age=3600"sv);
+    response_headers.set("Set-Cookie"sv, "session=secret"sv);
+    response_headers.set("set-cookie2"sv, "legacy=secret"sv);
+    disk_cache->store_entry(create_entry(key, response_headers, "welcome"sv));
+
+    // A hit must not set the cookie again, e.g. after the user has cleared it.
+    auto entry = open_entry(*disk_cache, key);
+    VERIFY(entry.has_value());
+    EXPECT(DiskCache::is_fresh(*entry, {}));
+    EXPECT(!entry->response_headers.contains("Set-Cookie"sv));
+    EXPECT(!entry->response_headers.contains("Set-Cookie2"sv));
+
+    // Nor may the cookie end up on disk.
+    MUST(Core::Directory::for_each_entry(directory->path().to_byte_string(), Core::DirIterator::SkipParentAndBaseDir, [&](Core::DirectoryEntry const& directory_entry, Core::Directory const&) -> ErrorOr<IterationDecision> {
+        auto file = TRY(Core::File::open(LexicalPath::join(directory->path().to_byte_string(), directory_entry.name).string(), Core::File::OpenMode::Read));
+        auto contents = TRY(file->read_until_eof());
+        EXPECT(!StringView { contents.bytes() }.contains("secret"sv));
+        return IterationDecision::Continue;
+    }));
+}
+
+TEST_CASE(entries_persist_across_instances)
+{
+    Core::EventLoop event_loop;
+
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    auto key = cache_key("https://example.com/style.css"sv);
+
+    {
+        auto disk_cache = create_disk_cache(*directory);
+        disk_cache->store_entry(create_entry(key, {}, "body { color: green; }"sv));
+
+        // Reads are queued behind writes, so this also waits for the store to reach the disk.
+        EXPECT(open_entry(*disk_cache, key).has_value());
+    }
+
+    auto disk_cache = create_disk_cache(*directory);
+
+    auto entry = open_entry(*disk_cache, key);
+    VERIFY(entry.has_value());
+    EXPECT_EQ(StringView { entry->body.bytes() }, "body { color: green; }"sv);
+}
+
+TEST_CASE(operations_completing_after_the_cache_is_destroyed_are_dropped)
+{
+    Core::EventLoop event_loop;
+
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    auto key = cache_key("https://example.com/font.woff2"sv);
+    bool first_read_completed = false;
+
+    {
+        auto disk_cache = create_disk_cache(*directory);
+        disk_cache->store_entry(create_entry(key, {}, "wOF2"sv));
+        disk_cache->open_entry(key, [&](auto) { first_read_completed = true; });
+    }
+
+    // Background operations run in order, so once this read completes, the ones issued above have completed as well.
+    auto disk_cache = create_disk_cache(*directory);
+    auto other_key = cache_key("https://example.com/other-font.woff2"sv);
+    disk_cache->store_entry(create_entry(other_key, {}, "wOF2"sv));
+    EXPECT(open_entry(*disk_cache, other_key).has_value());
+    EXPECT(!first_read_completed);
+}
+
+TEST_CASE(removed_entries_miss)
+{
+    Core::EventLoop event_loop;
+
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    auto disk_cache = create_disk_cache(*directory);
+
+    auto key = cache_key("https://example.com/image.png"sv);
+    disk_cache->store_entry(create_entry(key, {}, "PNG"sv));
+    disk_cache->remove_entry(key);
+
+    EXPECT(!open_entry(*disk_cache, key).has_value());
+
+    // Storing it again must not be undone by the removal that is still queued before it.
+    disk_cache->store_entry(create_entry(key, {}, "PNG"sv));
+    EXPECT(open_entry(*disk_cache, key).has_value());
+}
+
+TEST_CASE(entries_are_partitioned_by_top_level_site)
+{
+    Core::EventLoop event_loop;
+
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    auto disk_cache = create_disk_cache(*directory);
+
+    auto url = "https://cdn.example.net/library.js"sv;
+    auto key = cache_key(url, "https://www.example.com/"sv);
+
+    disk_cache->store_entry(create_entry(key, {}, "library"sv));
+
+    EXPECT(open_entry(*disk_cache, key).has_value());
+
+    // Documents on the same site share an entry.
+    EXPECT_EQ(cache_key(url, "https://shop.example.com/cart"sv), key);
+
+    // Documents on other sites, and the browser itself, do not.
+    EXPECT(!open_entry(*disk_cache, cache_key(url, "https://www.example.org/"sv)).has_value());
+    EXPECT(!open_entry(*disk_cache, cache_key(url, "http://www.example.com/"sv)).has_value());
+    EXPECT(!open_entry(*disk_cache, cache_key(url)).has_value());
+
+    // Opaque top-level origins never share anything.
+    EXPECT(!DiskCache::cache_key_for_request(*URL::Parser::basic_parse(url), URL::Origin::create_opaque()).has_value());
+}
+
+TEST_CASE(revalidation)
+{
+    Core::EventLoop event_loop;
+
+    auto directory = MUST(FileSystem::TempFile::create_temp_directory());
+    auto disk_cache = create_disk_cache(*directory);
+
+    auto key = cache_key("https://example.com/data.json"sv);
+
+    HTTP::HeaderMap response_headers;
+    response_headers.set("Cache-Control"sv, "no-cache"sv);
+    response_headers.set("ETag"sv, "\"v1\""sv);
+    response_headers.set("Content-Type"sv, "application/json"sv);
+    disk_cache->store_entry(create_entry(key, response_headers, "{}"sv));
+
+    auto entry = open_entry(*disk_cache, key);
+    VERIFY(entry.has_value());
+    EXPECT(!DiskCache::is_fresh(*entry, {}));
+
+    HTTP::HeaderMap request_headers;
+    EXPECT(DiskCache::add_conditional_request_headers(*entry, request_headers));
+    EXPECT_EQ(request_headers.get("If-None-Match"sv).value(), "\"v1\""sv);
+
+    // The origin server answers the conditional request with a 304, which updates the stored headers but not the body.
+    HTTP::HeaderMap not_modified_headers;
+    not_modified_headers.set("Cache-Control"sv, "max-age=3600"sv);
+    not_modified_headers.set("Content-Length"sv, "0"sv);
+
+    auto now = UnixDateTime::now();
+    disk_cache->freshen_entry(*entry, not_modified_headers, now, now);
+
+    auto freshened_entry = open_entry(*disk_cache, key);
+    VERIFY(freshened_entry.has_value());
+
+    EXPECT(DiskCache::is_fresh(*freshened_entry, {}));
+    EXPECT_EQ(freshened_entry->response_headers.get("Cache-Control"sv).value(), "max-age=3600"sv);
+    EXPECT_EQ(freshened_entry->response_headers.get("ETag"sv).value(), "\"v1\""sv);
+    EXPECT(!freshened_entry->response_headers.contains("Content-Length"sv));
+    EXPECT_EQ(StringView { freshened_entry->body.bytes() }, "{}"sv);
+
+    // A client revalidating its own copy with the same validator is told that it is still good.
+    EXPECT(DiskCache::is_not_modified(*freshened_entry, request_headers));
+
+    request_headers.set("If-None-Match"sv, "\"v2\""sv);
+    EXPECT(!DiskCache::is_not_modified(*freshened_entry, request_headers));
+
+    // The client may still ask us to go to the origin server.
+    HTTP::HeaderMap no_cache_request_headers;
+    no_cache_request_headers.set("Cache-Control"sv, "no-cache"sv);
+    EXPECT(!DiskCache::is_fresh(*freshened_entry, no_cache_request_headers));
+}
+
+TEST_CASE(requests_that_bypass_stored_responses)
+{
+    HTTP::HeaderMap request_headers;
+    EXPECT(DiskCache::may_use_stored_response("GET"sv, request_headers));
+    EXPECT(!DiskCache::may_use_stored_response("POST"sv, request_headers));
+
+    request_headers.set("Range"sv, "bytes=0-99"sv);
+    EXPECT(!DiskCache::may_use_stored_response("GET"sv, request_headers));
+
+    HTTP::HeaderMap no_store_request_headers;
+    no_store_request_headers.set("Cache-Control"sv, "no-store"sv);
+    EXPECT(!DiskCache::may_use_stored_response("GET"sv, no_store_request_headers));
+}